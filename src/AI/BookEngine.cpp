@@ -0,0 +1,14 @@
+#include "BookEngine.h"
+
+using namespace AI;
+
+BookEngine::BookEngine(
+        std::shared_ptr<const FileManagement::OpeningBook> book,
+        std::unique_ptr<Engine> fallbackEngine) : book(std::move(book)), fallbackEngine(std::move(fallbackEngine)) {}
+
+std::optional<Game::Move> BookEngine::findMove(Game::Board &board, Game::Side side) {
+    std::optional<Game::Move> bookMove = this->book->findMove(board, side);
+    if (bookMove.has_value()) return bookMove;
+
+    return this->fallbackEngine->findMove(board, side);
+}
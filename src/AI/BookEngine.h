@@ -0,0 +1,26 @@
+#ifndef PJC_HEXAGON_BOOKENGINE_H
+#define PJC_HEXAGON_BOOKENGINE_H
+
+#include <memory>
+#include "Engine.h"
+#include "../FileManagement/OpeningBook.h"
+
+namespace AI {
+    /**
+     * Plays the moves saved in the opening book without any search, positions which are not in the book
+     * are passed to the fallback engine.
+     */
+    class BookEngine : public Engine {
+    private:
+        // shared, as the book is only read and many engines can use the same mapped file
+        std::shared_ptr<const FileManagement::OpeningBook> book;
+        std::unique_ptr<Engine> fallbackEngine;
+
+    public:
+        BookEngine(std::shared_ptr<const FileManagement::OpeningBook> book, std::unique_ptr<Engine> fallbackEngine);
+
+        std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) override;
+    };
+}
+
+#endif //PJC_HEXAGON_BOOKENGINE_H
@@ -0,0 +1,242 @@
+#include "EndgameSolver.h"
+#include <algorithm>
+#include "SearchEngine.h"
+
+using namespace AI;
+
+namespace {
+    // mixed into the hashes of the positions reached after a skipped turn, as the game ends if the other side
+    // skips its turn as well
+    const std::uint64_t ENEMY_SKIPPED_KEY = 0xBB67AE8584CAA73BULL;
+    // added to the scores stored in the transposition table which depend on a line cut off by the plies limit
+    const int UNPROVEN_SCORE_OFFSET = 1 << 16;
+}
+
+EndgameSolver::EndgameSolver(
+        std::unique_ptr<Engine> fallbackEngine,
+        short emptyCellsThreshold,
+        std::chrono::milliseconds timeLimit,
+        std::size_t tableSizeInMegabytes)
+        : fallbackEngine(std::move(fallbackEngine)), emptyCellsThreshold(emptyCellsThreshold), timeLimit(timeLimit),
+          table(tableSizeInMegabytes) {}
+
+std::optional<Game::Move> EndgameSolver::findMove(Game::Board &board, Game::Side side) {
+    if (isSolvable(board)) {
+        std::optional<Game::Move> bestMove;
+        EndgameResult endgameResult = solvePosition(board, side, bestMove);
+
+        if (endgameResult.completed && bestMove.has_value()) return bestMove;
+    }
+
+    return this->fallbackEngine->findMove(board, side);
+}
+
+bool EndgameSolver::isSolvable(const Game::Board &board) const {
+    return !board.isGameFinished() && Game::Bitboards::count(board.getEmptyCells()) <= this->emptyCellsThreshold;
+}
+
+EndgameResult EndgameSolver::solvePosition(Game::Board &board, Game::Side side, std::optional<Game::Move> &bestMove) {
+    this->result = EndgameResult();
+    this->searchStart = std::chrono::steady_clock::now();
+    this->aborted = false;
+    bestMove = std::nullopt;
+
+    Game::Side enemySide = Game::Team::oppositeSide(side);
+    Game::MoveBuffer moves;
+    short movesCount = board.generateMoves(side, moves);
+    auto pliesLeft = static_cast<short>(Game::Bitboards::count(board.getEmptyCells()) + ENDGAME_EXTRA_PLIES);
+    bool proven = true;
+    int alpha = -SCORE_INFINITY;
+    std::optional<Game::CellMove> bestCellMove;
+
+    if (movesCount == 0)
+        alpha = -solve(board, enemySide, static_cast<short>(pliesLeft - 1), true, -SCORE_INFINITY, SCORE_INFINITY,
+                       proven);
+    else orderMoves(board, side, moves, movesCount);
+
+    for (short i = 0; i < movesCount && !this->aborted; i++) {
+        Game::UndoRecord undoRecord = board.makeMoveUnchecked(side, moves[i].from, moves[i].to);
+        int score = -solve(board, enemySide, static_cast<short>(pliesLeft - 1), false, -SCORE_INFINITY, -alpha,
+                           proven);
+        board.unmakeMove(undoRecord);
+
+        if (!this->aborted && score > alpha) {
+            alpha = score;
+            bestCellMove = moves[i];
+        }
+    }
+
+    this->result.completed = !this->aborted;
+    this->result.margin = alpha;
+    this->result.proven = this->result.completed && proven;
+    this->result.time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - this->searchStart);
+
+    if (this->result.completed && bestCellMove.has_value()) {
+        short from = bestCellMove->from;
+        short to = bestCellMove->to;
+        bestMove = Game::Move(
+                Game::MoveUnit(Game::Bitboards::cellRow(from), Game::Bitboards::cellUiColumn(from)),
+                Game::MoveUnit(Game::Bitboards::cellRow(to), Game::Bitboards::cellUiColumn(to)));
+    }
+
+    return this->result;
+}
+
+int EndgameSolver::solve(Game::Board &board, Game::Side side, short pliesLeft, bool enemySkipped, int alpha,
+                         int beta, bool &proven) {
+    if (isBudgetExceeded()) return 0;
+
+    if (board.isGameFinished()) return finalMargin(board, side);
+
+    if (pliesLeft <= 0) {
+        proven = false;
+        return finalMargin(board, side);
+    }
+
+    Game::Side enemySide = Game::Team::oppositeSide(side);
+    Game::MoveBuffer moves;
+    short movesCount = board.generateMoves(side, moves);
+
+    if (movesCount == 0) {
+        // the game ends when neither side can make a move, even with empty fields left
+        if (enemySkipped) return finalMargin(board, side);
+
+        return -solve(board, enemySide, static_cast<short>(pliesLeft - 1), true, -beta, -alpha, proven);
+    }
+
+    Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+    std::uint64_t hash = canonicalKey.key ^ (enemySkipped ? ENEMY_SKIPPED_KEY : 0);
+    std::optional<TranspositionEntry> entry = this->table.probe(hash);
+
+    if (entry.has_value() && entry->depth >= pliesLeft) {
+        bool entryProven = true;
+        int score = scoreFromTable(entry->score, entryProven);
+
+        if (entry->bound == ExactBound || (entry->bound == LowerBound && score >= beta) ||
+            (entry->bound == UpperBound && score <= alpha)) {
+            proven = proven && entryProven;
+            return score;
+        }
+    }
+
+    // ordering pays off only when there are enough plies left to search below the moves
+    if (pliesLeft > 2) orderMoves(board, side, moves, movesCount);
+
+    // the best move found in the previous search of the position is searched first
+    if (entry.has_value() && entry->from != NO_MOVE_CELL) {
+        Game::CellMove hashMove = Game::Symmetries::transformMove(Game::CellMove(entry->from, entry->to),
+                                                                  canonicalKey.symmetry);
+        for (short i = 0; i < movesCount; i++) {
+            if (moves[i].from == hashMove.from && moves[i].to == hashMove.to) {
+                std::rotate(moves.begin(), moves.begin() + i, moves.begin() + i + 1);
+                break;
+            }
+        }
+    }
+
+    int originalAlpha = alpha;
+    int bestScore = -SCORE_INFINITY;
+    short bestFrom = NO_MOVE_CELL;
+    short bestTo = NO_MOVE_CELL;
+    // a cutoff is proven by the move causing it alone, any other result needs all the moves to be proven
+    bool allMovesProven = true;
+    bool bestMoveProven = true;
+
+    for (short i = 0; i < movesCount; i++) {
+        bool moveProven = true;
+
+        Game::UndoRecord undoRecord = board.makeMoveUnchecked(side, moves[i].from, moves[i].to);
+        int score = -solve(board, enemySide, static_cast<short>(pliesLeft - 1), false, -beta, -alpha, moveProven);
+        board.unmakeMove(undoRecord);
+
+        if (this->aborted) return 0;
+
+        allMovesProven = allMovesProven && moveProven;
+        if (score > bestScore) {
+            bestScore = score;
+            bestFrom = moves[i].from;
+            bestTo = moves[i].to;
+            bestMoveProven = moveProven;
+        }
+        if (score > alpha) alpha = score;
+        if (alpha >= beta) break;
+    }
+
+    BoundType bound = ExactBound;
+    if (bestScore <= originalAlpha) bound = UpperBound;
+    else if (bestScore >= beta) bound = LowerBound;
+
+    bool nodeProven = bound == LowerBound ? bestMoveProven : allMovesProven;
+
+    if (bestFrom != NO_MOVE_CELL) {
+        bestFrom = Game::Symmetries::transformCell(bestFrom, canonicalKey.symmetry);
+        bestTo = Game::Symmetries::transformCell(bestTo, canonicalKey.symmetry);
+    }
+    this->table.store(hash, TranspositionEntry(scoreToTable(bestScore, nodeProven), pliesLeft, bound, bestFrom,
+                                               bestTo));
+
+    proven = proven && nodeProven;
+    return bestScore;
+}
+
+int EndgameSolver::scoreToTable(int score, bool proven) {
+    return proven ? score : score + UNPROVEN_SCORE_OFFSET;
+}
+
+int EndgameSolver::scoreFromTable(int score, bool &proven) {
+    proven = score < UNPROVEN_SCORE_OFFSET / 2;
+    return proven ? score : score - UNPROVEN_SCORE_OFFSET;
+}
+
+void EndgameSolver::orderMoves(Game::Board &board, Game::Side side, Game::MoveBuffer &moves, short movesCount) {
+    std::array<short, Game::MAX_MOVES_COUNT> repliesCounts{};
+    Game::Side enemySide = Game::Team::oppositeSide(side);
+    Game::MoveBuffer replies;
+
+    for (short i = 0; i < movesCount; i++) {
+        Game::UndoRecord undoRecord = board.makeMoveUnchecked(side, moves[i].from, moves[i].to);
+        // moves ending the game are the fastest of all
+        repliesCounts[i] = board.isGameFinished() ? static_cast<short>(-1) : board.generateMoves(enemySide, replies);
+        board.unmakeMove(undoRecord);
+    }
+
+    std::array<short, Game::MAX_MOVES_COUNT> order{};
+    for (short i = 0; i < movesCount; i++) order[i] = i;
+
+    std::stable_sort(order.begin(), order.begin() + movesCount, [&repliesCounts](short left, short right) {
+        return repliesCounts[left] < repliesCounts[right];
+    });
+
+    Game::MoveBuffer orderedMoves;
+    for (short i = 0; i < movesCount; i++) orderedMoves[i] = moves[order[i]];
+    std::copy(orderedMoves.begin(), orderedMoves.begin() + movesCount, moves.begin());
+}
+
+int EndgameSolver::finalMargin(const Game::Board &board, Game::Side side) {
+    Game::Points points = board.getPoints();
+    int sidePoints = points.getTeamPoints(side);
+    int enemyPoints = points.getTeamPoints(Game::Team::oppositeSide(side));
+    int emptyCellsCount = Game::Bitboards::count(board.getEmptyCells());
+
+    // the game gives all the empty fields to the side which still has pawns
+    if (enemyPoints == 0) sidePoints += emptyCellsCount;
+    else if (sidePoints == 0) enemyPoints += emptyCellsCount;
+
+    return sidePoints - enemyPoints;
+}
+
+bool EndgameSolver::isBudgetExceeded() {
+    this->result.nodes++;
+
+    // checking the clock is much slower than visiting a node, so it is done only every 1024 nodes
+    if (this->timeLimit.count() != 0 && (this->result.nodes & 1023) == 0 &&
+        std::chrono::steady_clock::now() - this->searchStart >= this->timeLimit)
+        this->aborted = true;
+
+    return this->aborted;
+}
+
+const EndgameResult &EndgameSolver::getLastResult() const {
+    return this->result;
+}
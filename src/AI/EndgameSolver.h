@@ -0,0 +1,118 @@
+#ifndef PJC_HEXAGON_ENDGAMESOLVER_H
+#define PJC_HEXAGON_ENDGAMESOLVER_H
+
+#include <chrono>
+#include <memory>
+#include "Engine.h"
+#include "TranspositionTable.h"
+
+namespace AI {
+    // positions with at most this many empty fields are solved by default
+    const short ENDGAME_EMPTY_CELLS_THRESHOLD = 6;
+    // jumps and skipped turns do not fill any field, so games can be longer than the count of the empty fields,
+    // the solver follows every line for at most this many plies more
+    const short ENDGAME_EXTRA_PLIES = 2;
+
+    /**
+     * Outcome of solving a position
+     */
+    class EndgameResult {
+    public:
+        // false if the time limit was reached before the position got solved
+        bool completed = false;
+        // points of the side making a move minus the enemy's points at the end of the game
+        int margin = 0;
+        // true if the margin does not depend on any line cut off by the plies limit, so the game is proven to be
+        // won, lost or drawn with exactly this margin
+        bool proven = false;
+        unsigned long long nodes = 0;
+        std::chrono::milliseconds time = std::chrono::milliseconds(0);
+    };
+
+    /**
+     * Searches positions with few empty fields to the end of the game, and plays the move which forces the best
+     * final margin. Positions with more empty fields, and the ones which cannot be solved within the time limit,
+     * are passed to the fallback engine.
+     *
+     * Jumps can be repeated endlessly, so every line is followed only until the empty fields could all be filled,
+     * plus \p ENDGAME_EXTRA_PLIES, and the lines cut off there are scored with their current points. Results which
+     * were not affected by any cut off line are marked as proven.
+     */
+    class EndgameSolver : public Engine {
+    private:
+        std::unique_ptr<Engine> fallbackEngine;
+        short emptyCellsThreshold;
+        std::chrono::milliseconds timeLimit;
+        // separate from the search's table, as the solver's scores are final margins and carry the proof status
+        TranspositionTable table;
+        EndgameResult result;
+        std::chrono::steady_clock::time_point searchStart;
+        bool aborted = false;
+
+        /**
+         * @param pliesLeft Plies after which the line is cut off
+         * @param enemySkipped Whether the enemy has skipped the previous turn, the game ends when both sides do
+         * @param proven Cleared if the result depends on a line cut off by the plies limit
+         * @return Final margin from the perspective of the \p side
+         */
+        int solve(Game::Board &board, Game::Side side, short pliesLeft, bool enemySkipped, int alpha, int beta,
+                  bool &proven);
+
+        /**
+         * Proof status is kept in the transposition table's scores, as the margins are much lower than the offset
+         */
+        static int scoreToTable(int score, bool proven);
+
+        static int scoreFromTable(int score, bool &proven);
+
+        /**
+         * Orders the moves so the ones leaving the enemy the fewest replies are searched first, as they
+         * finish the game the fastest and cause the most cutoffs
+         */
+        static void orderMoves(Game::Board &board, Game::Side side, Game::MoveBuffer &moves, short movesCount);
+
+        /**
+         * @return Margin of the finished game, a side which lost all the pawns loses the empty fields as well,
+         * also used for the lines cut off by the plies limit
+         */
+        static int finalMargin(const Game::Board &board, Game::Side side);
+
+        /**
+         * Counts the visited node and checks the time limit, once exceeded the search gets aborted
+         */
+        bool isBudgetExceeded();
+
+    public:
+        /**
+         * @param fallbackEngine Used in the positions which are not solved
+         * @param emptyCellsThreshold Positions with at most this many empty fields are solved
+         * @param timeLimit Zero means that the time is not limited
+         * @param tableSizeInMegabytes Size of the solver's transposition table
+         */
+        explicit EndgameSolver(
+                std::unique_ptr<Engine> fallbackEngine,
+                short emptyCellsThreshold = ENDGAME_EMPTY_CELLS_THRESHOLD,
+                std::chrono::milliseconds timeLimit = std::chrono::seconds(1),
+                std::size_t tableSizeInMegabytes = 16);
+
+        std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) override;
+
+        /**
+         * @return True if the position has few enough empty fields to be solved
+         */
+        bool isSolvable(const Game::Board &board) const;
+
+        /**
+         * Solves the position without falling back to the other engine
+         * @param bestMove Set to the move forcing the best margin, null option if it is not known
+         */
+        EndgameResult solvePosition(Game::Board &board, Game::Side side, std::optional<Game::Move> &bestMove);
+
+        /**
+         * @return Result of the last solved position
+         */
+        const EndgameResult &getLastResult() const;
+    };
+}
+
+#endif //PJC_HEXAGON_ENDGAMESOLVER_H
@@ -0,0 +1,26 @@
+#ifndef PJC_HEXAGON_ENGINE_H
+#define PJC_HEXAGON_ENGINE_H
+
+#include <optional>
+#include "../Game/Board.h"
+
+namespace AI {
+    /**
+     * Base class for the computer players, similarly to UI::UI it allows adding new implementations
+     * without changing the game loop.
+     */
+    class Engine {
+    public:
+        virtual ~Engine() = default;
+
+        /**
+         * @param board Current board, engine can make and unmake moves on it while searching,
+         * but it is always left in the same state in which it was passed
+         * @param side Side making a move
+         * @return Move picked by the engine, null option if no move can be made
+         */
+        virtual std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) = 0;
+    };
+}
+
+#endif //PJC_HEXAGON_ENGINE_H
@@ -0,0 +1,9 @@
+#include "Evaluation.h"
+
+using namespace AI;
+
+int PointsEvaluation::evaluate(const Game::Board &board, Game::Side side) const {
+    Game::Points points = board.getPoints();
+
+    return points.getTeamPoints(side) - points.getTeamPoints(Game::Team::oppositeSide(side));
+}
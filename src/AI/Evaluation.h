@@ -0,0 +1,30 @@
+#ifndef PJC_HEXAGON_EVALUATION_H
+#define PJC_HEXAGON_EVALUATION_H
+
+#include "../Game/Board.h"
+
+namespace AI {
+    /**
+     * Scores positions for the search, implementations can be swapped in order to tune the computer players.
+     */
+    class Evaluation {
+    public:
+        virtual ~Evaluation() = default;
+
+        /**
+         * @return Score of the \p board from the perspective of the \p side, the higher the better for the \p side.
+         * Evaluations have to be symmetric, meaning that the enemy's score has to be the negation of the \p side's score
+         */
+        virtual int evaluate(const Game::Board &board, Game::Side side) const = 0;
+    };
+
+    /**
+     * Default evaluation, difference between the side's points and the enemy's points.
+     */
+    class PointsEvaluation : public Evaluation {
+    public:
+        int evaluate(const Game::Board &board, Game::Side side) const override;
+    };
+}
+
+#endif //PJC_HEXAGON_EVALUATION_H
@@ -0,0 +1,7 @@
+#include "GreedyEngine.h"
+
+using namespace AI;
+
+std::optional<Game::Move> GreedyEngine::findMove(Game::Board &board, Game::Side side) {
+    return board.findBestMove(side);
+}
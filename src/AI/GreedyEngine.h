@@ -0,0 +1,16 @@
+#ifndef PJC_HEXAGON_GREEDYENGINE_H
+#define PJC_HEXAGON_GREEDYENGINE_H
+
+#include "Engine.h"
+
+namespace AI {
+    /**
+     * Picks the move gaining the most points right away, see \p Game::Board::findBestMove.
+     */
+    class GreedyEngine : public Engine {
+    public:
+        std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) override;
+    };
+}
+
+#endif //PJC_HEXAGON_GREEDYENGINE_H
@@ -0,0 +1,209 @@
+#include "MctsEngine.h"
+#include <cmath>
+
+using namespace AI;
+
+MctsLimits::MctsLimits(unsigned long long playouts, std::chrono::milliseconds time) : playouts(playouts), time(time) {}
+
+MctsNode::MctsNode(short from, short to, unsigned int parent)
+        : from(from), to(to), parent(parent), firstChild(0), childrenCount(0), expanded(false), visits(0), wins(0) {}
+
+MctsEngine::MctsEngine(MctsLimits limits, unsigned int nodesCapacity, std::uint64_t seed)
+        // the root with all its children always fits, otherwise it could not be expanded and no move would be found
+        : limits(limits), nodes(std::max(nodesCapacity, 1u + Game::MAX_MOVES_COUNT)), generator(seed) {}
+
+short MctsEngine::keepGreediestMoves(const Game::Board &board, Game::Side side,
+                                     Game::MoveBuffer &moves, short movesCount) {
+    Game::Bitboard enemyCells = board.getSideCells(Game::Team::oppositeSide(side));
+    short bestGain = -1;
+    short bestMovesCount = 0;
+
+    for (short i = 0; i < movesCount; i++) {
+        short gain = Game::Bitboards::count(Game::Bitboards::borderingCells(moves[i].to) & enemyCells);
+        if ((Game::Bitboards::borderingCells(moves[i].from) & Game::Bitboards::cellMask(moves[i].to)) != 0)
+            gain++;
+
+        if (gain > bestGain) {
+            bestGain = gain;
+            bestMovesCount = 0;
+        }
+        if (gain == bestGain) moves[bestMovesCount++] = moves[i];
+    }
+
+    return bestMovesCount;
+}
+
+double MctsEngine::gameResult(const Game::Board &board, Game::Side side) {
+    Game::Points points = board.getPoints();
+    unsigned short sidePoints = points.getTeamPoints(side);
+    unsigned short enemyPoints = points.getTeamPoints(Game::Team::oppositeSide(side));
+
+    if (sidePoints > enemyPoints) return 1;
+    if (sidePoints < enemyPoints) return 0;
+    return 0.5;
+}
+
+void MctsEngine::applyNodeMove(Game::Board &board, Game::Side side, const MctsNode &node) {
+    if (node.from == Game::NO_CELL) return;
+
+    board.makeMoveUnchecked(side, node.from, node.to);
+    board.fillBoardIfSideEliminated();
+}
+
+void MctsEngine::expand(unsigned int nodeIndex, const Game::Board &board, Game::Side side) {
+    Game::MoveBuffer moves;
+    short movesCount = board.generateMoves(side, moves);
+    MctsNode &node = this->nodes[nodeIndex];
+
+    // when the enemy has just skipped a turn as well, the game cannot be continued and the node is left
+    // without children
+    bool isStuck = movesCount == 0 && nodeIndex != 0 && node.from == Game::NO_CELL;
+    unsigned int childrenCount = movesCount == 0 ? (isStuck ? 0 : 1) : movesCount;
+
+    if (this->nodesCount + childrenCount > this->nodes.size()) return;
+
+    node.expanded = true;
+    node.firstChild = this->nodesCount;
+    node.childrenCount = static_cast<unsigned short>(childrenCount);
+
+    if (movesCount == 0 && !isStuck) this->nodes[this->nodesCount++] = MctsNode(Game::NO_CELL, Game::NO_CELL, nodeIndex);
+
+    for (short i = 0; i < movesCount; i++)
+        this->nodes[this->nodesCount++] = MctsNode(moves[i].from, moves[i].to, nodeIndex);
+}
+
+unsigned int MctsEngine::selectChild(unsigned int nodeIndex) {
+    const MctsNode &node = this->nodes[nodeIndex];
+    double logVisits = std::log(static_cast<double>(std::max(node.visits, 1u)));
+
+    unsigned int bestChild = node.firstChild;
+    double bestScore = -1;
+
+    for (unsigned int child = node.firstChild; child < node.firstChild + node.childrenCount; child++) {
+        const MctsNode &childNode = this->nodes[child];
+        if (childNode.visits == 0) return child;
+
+        double score = childNode.wins / childNode.visits +
+                       UCT_EXPLORATION * std::sqrt(logVisits / childNode.visits);
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestChild = child;
+        }
+    }
+
+    return bestChild;
+}
+
+double MctsEngine::playout(Game::Board &board, Game::Side side, Game::Side perspective) {
+    Game::MoveBuffer moves;
+    bool previousSideSkipped = false;
+
+    for (short ply = 0; ply < MAX_PLAYOUT_PLIES && !board.isGameFinished(); ply++) {
+        short movesCount = board.generateMoves(side, moves);
+
+        if (movesCount != 0) {
+            // most of the time one of the moves gaining the most fields is picked, purely random playouts
+            // make both sides give away their pawns and say very little about the position
+            if (std::uniform_real_distribution<double>(0, 1)(this->generator) >= PLAYOUT_RANDOM_MOVE_CHANCE)
+                movesCount = keepGreediestMoves(board, side, moves, movesCount);
+
+            std::uniform_int_distribution<int> distribution(0, movesCount - 1);
+            const Game::CellMove &move = moves[distribution(this->generator)];
+
+            board.makeMoveUnchecked(side, move.from, move.to);
+            board.fillBoardIfSideEliminated();
+            previousSideSkipped = false;
+        } else if (previousSideSkipped) break;
+        else previousSideSkipped = true;
+
+        side = Game::Team::oppositeSide(side);
+    }
+
+    return gameResult(board, perspective);
+}
+
+std::optional<Game::Move> MctsEngine::findMove(Game::Board &board, Game::Side side) {
+    auto start = std::chrono::steady_clock::now();
+    this->statistics = MctsStatistics();
+
+    if (board.isGameFinished()) return std::nullopt;
+
+    this->nodes[0] = MctsNode(Game::NO_CELL, Game::NO_CELL, 0);
+    this->nodesCount = 1;
+    expand(0, board, side);
+
+    const MctsNode &root = this->nodes[0];
+    if (root.childrenCount == 0 || this->nodes[root.firstChild].from == Game::NO_CELL) return std::nullopt;
+
+    while (this->limits.playouts == 0 || this->statistics.playouts < this->limits.playouts) {
+        // checking the clock is relatively slow, so it's done once per 64 playouts
+        if (this->limits.time.count() != 0 && this->statistics.playouts % 64 == 0 &&
+            std::chrono::steady_clock::now() - start >= this->limits.time)
+            break;
+
+        Game::Board searchBoard = board;
+        Game::Side currentSide = side;
+        unsigned int nodeIndex = 0;
+
+        // selection, walking down the tree through the already expanded nodes
+        while (this->nodes[nodeIndex].expanded && this->nodes[nodeIndex].childrenCount != 0 &&
+               !searchBoard.isGameFinished()) {
+            nodeIndex = selectChild(nodeIndex);
+            applyNodeMove(searchBoard, currentSide, this->nodes[nodeIndex]);
+            currentSide = Game::Team::oppositeSide(currentSide);
+        }
+
+        // expansion, the tree grows by the children of a single node in every iteration
+        if (!this->nodes[nodeIndex].expanded && !searchBoard.isGameFinished()) {
+            expand(nodeIndex, searchBoard, currentSide);
+
+            if (this->nodes[nodeIndex].childrenCount != 0) {
+                nodeIndex = selectChild(nodeIndex);
+                applyNodeMove(searchBoard, currentSide, this->nodes[nodeIndex]);
+                currentSide = Game::Team::oppositeSide(currentSide);
+            }
+        }
+
+        // the result is counted for the side which made the move leading to the node
+        double result = playout(searchBoard, currentSide, Game::Team::oppositeSide(currentSide));
+
+        // backpropagation, the result is flipped at every level, as the sides take turns
+        for (unsigned int index = nodeIndex;; index = this->nodes[index].parent) {
+            this->nodes[index].visits++;
+            this->nodes[index].wins += result;
+            result = 1 - result;
+
+            if (index == 0) break;
+        }
+
+        this->statistics.playouts++;
+    }
+
+    unsigned int bestChild = root.firstChild;
+    for (unsigned int child = root.firstChild; child < root.firstChild + root.childrenCount; child++) {
+        if (this->nodes[child].visits > this->nodes[bestChild].visits) bestChild = child;
+    }
+
+    const MctsNode &bestNode = this->nodes[bestChild];
+    this->statistics.nodes = this->nodesCount;
+    this->statistics.winRate = bestNode.visits != 0 ? bestNode.wins / bestNode.visits : 0;
+    this->statistics.time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start);
+
+    return Game::Move(
+            Game::MoveUnit(Game::Bitboards::cellRow(bestNode.from), Game::Bitboards::cellUiColumn(bestNode.from)),
+            Game::MoveUnit(Game::Bitboards::cellRow(bestNode.to), Game::Bitboards::cellUiColumn(bestNode.to)));
+}
+
+const MctsStatistics &MctsEngine::getStatistics() const {
+    return this->statistics;
+}
+
+const MctsLimits &MctsEngine::getLimits() const {
+    return this->limits;
+}
+
+void MctsEngine::setLimits(MctsLimits _limits) {
+    this->limits = _limits;
+}
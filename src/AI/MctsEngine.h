@@ -0,0 +1,137 @@
+#ifndef PJC_HEXAGON_MCTSENGINE_H
+#define PJC_HEXAGON_MCTSENGINE_H
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include "Engine.h"
+
+namespace AI {
+    // exploration constant of the UCT formula, higher values make the search wider
+    const double UCT_EXPLORATION = 1.4;
+    // playouts longer than this are stopped and decided by the points
+    const short MAX_PLAYOUT_PLIES = 200;
+    // chance of a playout move being picked from all the legal moves instead of the ones gaining the most fields
+    const double PLAYOUT_RANDOM_MOVE_CHANCE = 0.1;
+
+    /**
+     * Budget of a single search, the search stops when any of the limits is reached
+     */
+    class MctsLimits {
+    public:
+        // zero means that the count of playouts is not limited
+        unsigned long long playouts = 10000;
+        // zero means that the time is not limited
+        std::chrono::milliseconds time = std::chrono::milliseconds(0);
+
+        MctsLimits() = default;
+
+        MctsLimits(unsigned long long playouts, std::chrono::milliseconds time);
+    };
+
+    /**
+     * Information about the last finished search
+     */
+    class MctsStatistics {
+    public:
+        unsigned long long playouts = 0;
+        // count of nodes created in the tree
+        unsigned int nodes = 0;
+        // part of the playouts won by the side making the picked move, draws count as half of a win
+        double winRate = 0;
+        std::chrono::milliseconds time = std::chrono::milliseconds(0);
+    };
+
+    /**
+     * Node of the search tree, nodes are kept in a pool and refer to each other with indexes
+     */
+    class MctsNode {
+    public:
+        // move leading to the node, NO_CELL for the root and for skipped turns
+        short from;
+        short to;
+        unsigned int parent;
+        // children of a node are always placed next to each other in the pool
+        unsigned int firstChild;
+        unsigned short childrenCount;
+        bool expanded;
+        unsigned int visits;
+        // sum of the playout results from the perspective of the side which made the move leading to the node
+        double wins;
+
+        MctsNode() = default;
+
+        MctsNode(short from, short to, unsigned int parent);
+    };
+
+    /**
+     * Monte Carlo Tree Search with the UCT selection, positions are scored by random playouts.
+     * Nodes are stored in a pool allocated once by the engine, and both the tree walk and the playouts
+     * are made on a single copy of the searched board, so the search itself does not allocate memory.
+     */
+    class MctsEngine : public Engine {
+    private:
+        MctsLimits limits;
+        std::vector<MctsNode> nodes;
+        unsigned int nodesCount = 0;
+        std::mt19937_64 generator;
+        MctsStatistics statistics;
+
+        /**
+         * Creates children for all the moves of the \p side, or a single child skipping the turn if there are
+         * no legal moves. Does nothing if the pool is full.
+         */
+        void expand(unsigned int nodeIndex, const Game::Board &board, Game::Side side);
+
+        /**
+         * @return Index of the child with the highest UCT score, unvisited children are picked first
+         */
+        unsigned int selectChild(unsigned int nodeIndex);
+
+        /**
+         * Plays moves until the game is finished, most of them are greedy ones picked at random from
+         * the moves gaining the most fields
+         * @return Result from the perspective of the \p side, 1 for a win, 0.5 for a draw and 0 for a loss
+         */
+        double playout(Game::Board &board, Game::Side side, Game::Side perspective);
+
+        /**
+         * Moves the moves gaining the most fields to the beginning of the \p moves, a clone move gains
+         * the field it is made to, and every move gains the captured enemy fields
+         * @return Count of the moves gaining the most fields
+         */
+        static short keepGreediestMoves(const Game::Board &board, Game::Side side,
+                                        Game::MoveBuffer &moves, short movesCount);
+
+        /**
+         * @return Result of a finished game from the perspective of the \p side
+         */
+        static double gameResult(const Game::Board &board, Game::Side side);
+
+        /**
+         * Makes the move of a node, nodes with no move skip the turn
+         */
+        static void applyNodeMove(Game::Board &board, Game::Side side, const MctsNode &node);
+
+    public:
+        /**
+         * @param nodesCapacity Size of the nodes pool, once it is full the tree stops growing but
+         * the playouts continue. The pool can always hold the children of the root, even if it is smaller.
+         * @param seed Searches started with the same seed and limited only by the playouts give the same results
+         */
+        explicit MctsEngine(
+                MctsLimits limits = MctsLimits(),
+                unsigned int nodesCapacity = 1 << 20,
+                std::uint64_t seed = std::random_device()());
+
+        std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) override;
+
+        const MctsStatistics &getStatistics() const;
+
+        const MctsLimits &getLimits() const;
+
+        void setLimits(MctsLimits _limits);
+    };
+}
+
+#endif //PJC_HEXAGON_MCTSENGINE_H
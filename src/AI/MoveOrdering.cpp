@@ -0,0 +1,84 @@
+#include "MoveOrdering.h"
+#include <algorithm>
+#include "../Game/CaptureCounter.h"
+
+using namespace AI;
+
+namespace {
+    // move scores are built from bit fields, so every criterion outweighs all the criteria after it
+    const std::uint32_t HASH_MOVE_SCORE = UINT32_MAX;
+    const int CAPTURES_SHIFT = 26;
+    const int CLONE_SHIFT = 25;
+    const int KILLER_SHIFT = 23;
+    const std::uint32_t MAX_HISTORY_SCORE = (1u << KILLER_SHIFT) - 1;
+}
+
+MoveOrdering::MoveOrdering() {
+    newSearch();
+    for (auto &moves: this->history) moves.fill(0);
+}
+
+void MoveOrdering::newSearch() {
+    for (auto &plyKillers: this->killers) plyKillers.fill(Game::CellMove(Game::NO_CELL, Game::NO_CELL));
+    for (auto &moves: this->history) {
+        for (std::uint32_t &score: moves) score /= 2;
+    }
+}
+
+void MoveOrdering::scoreMoves(
+        const Game::Board &board,
+        Game::Side side,
+        const Game::MoveBuffer &moves,
+        short movesCount,
+        short ply,
+        std::optional<Game::CellMove> hashMove,
+        MoveScores &scores) const {
+    // captures depend only on the field to which a move is made, so they are counted for all the fields at once,
+    // in the same way as in Board::findBestMove
+    Game::BorderingCounts capturesCounts;
+    Game::CaptureCounter::countBorderingCells(board.getSideCells(Game::Team::oppositeSide(side)), capturesCounts);
+
+    for (short i = 0; i < movesCount; i++) {
+        const Game::CellMove &move = moves[i];
+
+        if (hashMove.has_value() && move.from == hashMove->from && move.to == hashMove->to) {
+            scores[i] = HASH_MOVE_SCORE;
+            continue;
+        }
+
+        std::uint32_t score = static_cast<std::uint32_t>(capturesCounts[move.to]) << CAPTURES_SHIFT;
+        if (Game::Bitboards::borderingCells(move.from) & Game::Bitboards::cellMask(move.to))
+            score |= 1u << CLONE_SHIFT;
+
+        if (ply < MAX_KILLER_PLY) {
+            const std::array<Game::CellMove, 2> &plyKillers = this->killers[ply];
+            if (move.from == plyKillers[0].from && move.to == plyKillers[0].to) score |= 2u << KILLER_SHIFT;
+            else if (move.from == plyKillers[1].from && move.to == plyKillers[1].to) score |= 1u << KILLER_SHIFT;
+        }
+
+        scores[i] = score | std::min(this->history[move.from][move.to], MAX_HISTORY_SCORE);
+    }
+}
+
+void MoveOrdering::pickMove(Game::MoveBuffer &moves, MoveScores &scores, short index, short movesCount) {
+    short bestIndex = index;
+    for (short i = static_cast<short>(index + 1); i < movesCount; i++) {
+        if (scores[i] > scores[bestIndex]) bestIndex = i;
+    }
+
+    std::swap(moves[index], moves[bestIndex]);
+    std::swap(scores[index], scores[bestIndex]);
+}
+
+void MoveOrdering::recordCutoff(Game::CellMove move, short ply, short depth) {
+    if (ply < MAX_KILLER_PLY) {
+        std::array<Game::CellMove, 2> &plyKillers = this->killers[ply];
+        if (move.from != plyKillers[0].from || move.to != plyKillers[0].to) {
+            plyKillers[1] = plyKillers[0];
+            plyKillers[0] = move;
+        }
+    }
+
+    std::uint32_t &score = this->history[move.from][move.to];
+    score = std::min(score + static_cast<std::uint32_t>(depth * depth), MAX_HISTORY_SCORE);
+}
@@ -0,0 +1,59 @@
+#ifndef PJC_HEXAGON_MOVEORDERING_H
+#define PJC_HEXAGON_MOVEORDERING_H
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include "../Game/Board.h"
+
+namespace AI {
+    // killer moves are kept only for this many plies, deeper nodes are ordered without them
+    const short MAX_KILLER_PLY = 64;
+
+    // scores by which the moves are ordered, indexed in the same way as the moves in a \p Game::MoveBuffer
+    using MoveScores = std::array<std::uint32_t, Game::MAX_MOVES_COUNT>;
+
+    /**
+     * Orders the moves of the searched positions, so the ones most likely to cause a cutoff are searched first.
+     * The best move saved in the transposition table goes first, then the moves capturing the most enemy pawns,
+     * clone moves before jumps, the killer moves of the ply, and finally the moves with the highest history scores.
+     * Killer moves and the history are learned from the cutoffs found by the search.
+     */
+    class MoveOrdering {
+    private:
+        // two latest moves which caused a cutoff at every ply, the newer one first
+        std::array<std::array<Game::CellMove, 2>, MAX_KILLER_PLY> killers;
+        // sums of the squared depths of the cutoffs caused by every move, indexed by the fields from and to
+        std::array<std::array<std::uint32_t, BOARD_CELLS_COUNT>, BOARD_CELLS_COUNT> history;
+
+    public:
+        MoveOrdering();
+
+        /**
+         * Should be called before every search, killer moves are forgotten, while the history is only halved,
+         * as most of it is still valid a move later
+         */
+        void newSearch();
+
+        /**
+         * @param hashMove Best move saved in the transposition table for the position
+         */
+        void scoreMoves(const Game::Board &board, Game::Side side, const Game::MoveBuffer &moves, short movesCount,
+                        short ply, std::optional<Game::CellMove> hashMove, MoveScores &scores) const;
+
+        /**
+         * Moves are picked one by one instead of being sorted up front, as most of them are never searched
+         * after a cutoff
+         * @param index Position to which the best of the moves placed at and after it is swapped, along with its
+         * score
+         */
+        static void pickMove(Game::MoveBuffer &moves, MoveScores &scores, short index, short movesCount);
+
+        /**
+         * @param depth Remaining depth of the node, cutoffs found higher in the tree get bigger history scores
+         */
+        void recordCutoff(Game::CellMove move, short ply, short depth);
+    };
+}
+
+#endif //PJC_HEXAGON_MOVEORDERING_H
@@ -0,0 +1,105 @@
+#include "OpeningBookBuilder.h"
+
+using namespace AI;
+
+std::size_t OpeningBookBuilder::addSearchedPositions(
+        short plies,
+        const SearchLimits &limits,
+        const std::function<void(std::size_t)> &progressCallback) {
+    std::size_t searchedCount = this->searchedMoves.size();
+    SearchEngine engine(limits);
+
+    for (Game::Side bookSide: {Game::RedSide, Game::BlueSide}) {
+        Game::Board board = Game::Board::getInitialPosition();
+        addSearchedTree(engine, board, Game::RedSide, bookSide, plies, progressCallback);
+    }
+
+    return this->searchedMoves.size() - searchedCount;
+}
+
+void OpeningBookBuilder::addSearchedTree(
+        SearchEngine &engine,
+        Game::Board &board,
+        Game::Side side,
+        Game::Side bookSide,
+        short plies,
+        const std::function<void(std::size_t)> &progressCallback) {
+    if (plies <= 0 || board.isGameFinished() || !board.hasLegalMove(side)) return;
+
+    Game::Side enemySide = Game::Team::oppositeSide(side);
+
+    if (side != bookSide) {
+        Game::MoveBuffer moves;
+        short movesCount = board.generateMoves(side, moves);
+
+        for (short i = 0; i < movesCount; i++) {
+            Game::UndoRecord undoRecord = board.makeMoveUnchecked(side, moves[i].from, moves[i].to);
+            addSearchedTree(engine, board, enemySide, bookSide, static_cast<short>(plies - 1), progressCallback);
+            board.unmakeMove(undoRecord);
+        }
+        return;
+    }
+
+    Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+    auto searchedMove = this->searchedMoves.find(canonicalKey.key);
+
+    // equivalent positions, reached by different move orders or mirrored ones, are searched only once, but their
+    // subtrees are followed again, as they can be reached with more plies left
+    if (searchedMove == this->searchedMoves.end()) {
+        std::optional<Game::Move> move = engine.findMove(board, side);
+        if (!move.has_value()) return;
+
+        FileManagement::BookEntry entry = FileManagement::OpeningBook::createEntry(
+                board, side,
+                Game::CellMove(Game::Bitboards::cellIndex(move->from), Game::Bitboards::cellIndex(move->to)), 1);
+        searchedMove = this->searchedMoves.emplace(entry.key, Game::CellMove(entry.from, entry.to)).first;
+        this->entries.emplace_back(entry);
+
+        if (progressCallback) progressCallback(this->searchedMoves.size());
+    }
+
+    Game::CellMove move = Game::Symmetries::transformMove(searchedMove->second, canonicalKey.symmetry);
+    Game::UndoRecord undoRecord = board.makeMoveUnchecked(side, move.from, move.to);
+    addSearchedTree(engine, board, enemySide, bookSide, static_cast<short>(plies - 1), progressCallback);
+    board.unmakeMove(undoRecord);
+}
+
+std::size_t OpeningBookBuilder::addGames(const std::vector<FileManagement::GameReplay> &games, unsigned int plies) {
+    std::size_t addedCount = 0;
+
+    for (FileManagement::GameReplay game: games) {
+        if (!game.isFinished()) continue;
+
+        game.seek(game.getPliesCount());
+        unsigned short redPoints = game.getBoard().getPoints().getTeamPoints(Game::RedSide);
+        unsigned short bluePoints = game.getBoard().getPoints().getTeamPoints(Game::BlueSide);
+        if (redPoints == bluePoints) continue;
+
+        Game::Side winningSide = redPoints > bluePoints ? Game::RedSide : Game::BlueSide;
+
+        game.seek(0);
+        for (unsigned int ply = 1; ply <= std::min(plies, game.getPliesCount()); ply++) {
+            std::optional<Game::Move> move = game.getMove(ply);
+
+            if (game.getSide() == winningSide && move.has_value()) {
+                this->entries.emplace_back(FileManagement::OpeningBook::createEntry(
+                        game.getBoard(), game.getSide(),
+                        Game::CellMove(Game::Bitboards::cellIndex(move->from), Game::Bitboards::cellIndex(move->to)),
+                        1));
+                addedCount++;
+            }
+
+            game.next();
+        }
+    }
+
+    return addedCount;
+}
+
+const std::vector<FileManagement::BookEntry> &OpeningBookBuilder::getEntries() const {
+    return this->entries;
+}
+
+bool OpeningBookBuilder::write(const std::string &fileName) const {
+    return FileManagement::OpeningBook::write(fileName, this->entries);
+}
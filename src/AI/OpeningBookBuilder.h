@@ -0,0 +1,57 @@
+#ifndef PJC_HEXAGON_OPENINGBOOKBUILDER_H
+#define PJC_HEXAGON_OPENINGBOOKBUILDER_H
+
+#include <functional>
+#include <unordered_map>
+#include "SearchEngine.h"
+#include "../FileManagement/GameReplay.h"
+#include "../FileManagement/OpeningBook.h"
+
+namespace AI {
+    /**
+     * Collects the entries of an opening book, from the searches of the positions reachable from the initial
+     * position and from the games played earlier, e.g. recorded by the arena's self-play.
+     */
+    class OpeningBookBuilder {
+    private:
+        std::vector<FileManagement::BookEntry> entries;
+        // moves found for the already searched positions, by the key of the position, saved as the moves
+        // of the canonical positions
+        std::unordered_map<std::uint64_t, Game::CellMove> searchedMoves;
+
+        /**
+         * Searches the position if the \p bookSide makes a move and follows only the found move, otherwise
+         * follows every legal move of the enemy
+         */
+        void addSearchedTree(SearchEngine &engine, Game::Board &board, Game::Side side, Game::Side bookSide,
+                             short plies, const std::function<void(std::size_t)> &progressCallback);
+
+    public:
+        /**
+         * Every searched position gets its best move with the weight of 1. The tree is built for both sides,
+         * the book's side plays only the searched moves and the enemy plays all the legal moves.
+         * @param plies Positions reachable from the initial position within this many plies are searched
+         * @param progressCallback Receives the count of the searched positions after every search
+         * @return Count of the searched positions
+         */
+        std::size_t addSearchedPositions(short plies, const SearchLimits &limits,
+                                         const std::function<void(std::size_t)> &progressCallback = nullptr);
+
+        /**
+         * Every move of the side which won a finished game adds 1 to the weight of that move, so the moves
+         * which won most often are preferred. Drawn and unfinished games are skipped.
+         * @param plies Only the moves of the first plies of every game are added
+         * @return Count of the added moves
+         */
+        std::size_t addGames(const std::vector<FileManagement::GameReplay> &games, unsigned int plies);
+
+        const std::vector<FileManagement::BookEntry> &getEntries() const;
+
+        /**
+         * @return False if the file cannot be written
+         */
+        bool write(const std::string &fileName) const;
+    };
+}
+
+#endif //PJC_HEXAGON_OPENINGBOOKBUILDER_H
@@ -0,0 +1,187 @@
+#include "ParallelSearchEngine.h"
+
+using namespace AI;
+
+ParallelSearchEngine::ParallelSearchEngine(
+        SearchLimits limits,
+        ParallelMode mode,
+        unsigned int threadsCount,
+        std::shared_ptr<const Evaluation> evaluation,
+        std::shared_ptr<TranspositionTable> transpositionTable) {
+    this->limits = limits;
+    this->mode = mode;
+    this->threadsCount = threadsCount != 0 ? threadsCount : std::max(std::thread::hardware_concurrency(), 1u);
+    this->evaluation = evaluation != nullptr ? std::move(evaluation) : std::make_shared<PointsEvaluation>();
+    this->transpositionTable = transpositionTable != nullptr
+                               ? std::move(transpositionTable)
+                               : std::make_shared<TranspositionTable>();
+}
+
+std::optional<Game::Move> ParallelSearchEngine::findMove(Game::Board &board, Game::Side side) {
+    auto searchStart = std::chrono::steady_clock::now();
+    this->statistics = SearchStatistics();
+
+    std::optional<Game::Move> move = this->mode == RootSplit
+                                     ? findMoveWithRootSplit(board, side)
+                                     : findMoveWithLazySmp(board, side);
+
+    this->statistics.time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - searchStart);
+
+    return move;
+}
+
+std::vector<SearchEngine> ParallelSearchEngine::createEngines(const std::atomic<bool> &stopSignal) const {
+    SearchLimits threadLimits = this->limits;
+    if (threadLimits.nodes != 0) threadLimits.nodes = std::max(threadLimits.nodes / this->threadsCount, 1ull);
+
+    std::vector<SearchEngine> engines;
+    engines.reserve(this->threadsCount);
+
+    for (unsigned int i = 0; i < this->threadsCount; i++) {
+        engines.emplace_back(threadLimits, this->evaluation, this->transpositionTable);
+        engines.back().setStopSignal(&stopSignal);
+    }
+
+    return engines;
+}
+
+std::optional<Game::Move> ParallelSearchEngine::findMoveWithRootSplit(const Game::Board &board, Game::Side side) {
+    std::vector<Game::MoveWithBorderingStatus> moves = board.findLegalMoves(side, std::nullopt);
+    if (moves.empty()) return std::nullopt;
+
+    std::atomic<bool> stopSignal{false};
+    std::vector<SearchEngine> engines = createEngines(stopSignal);
+    std::vector<Game::Board> boards(this->threadsCount, board);
+
+    for (SearchEngine &engine: engines) engine.beginSearch();
+
+    for (short depth = 1; depth <= this->limits.depth; depth++) {
+        std::atomic<size_t> nextMoveIndex{0};
+        // best score found so far in the iteration, moves searched later only have to beat it
+        std::atomic<int> sharedAlpha{-SCORE_INFINITY};
+        std::vector<std::optional<int>> scores(moves.size());
+        // alpha with which every move was searched, scores not above it are only upper bounds
+        std::vector<int> searchAlphas(moves.size(), -SCORE_INFINITY);
+
+        std::vector<std::thread> workers;
+        for (unsigned int t = 0; t < this->threadsCount; t++) {
+            workers.emplace_back([&, t]() {
+                for (size_t i = nextMoveIndex++; i < moves.size(); i = nextMoveIndex++) {
+                    searchAlphas[i] = sharedAlpha.load();
+                    std::optional<int> score = engines[t].searchMove(
+                            boards[t],
+                            side,
+                            Game::Bitboards::cellIndex(moves[i].from),
+                            Game::Bitboards::cellIndex(moves[i].to),
+                            depth,
+                            searchAlphas[i]);
+
+                    // once any thread runs out of the budget, all the others are stopped as well
+                    if (!score.has_value()) {
+                        stopSignal = true;
+                        return;
+                    }
+
+                    scores[i] = score;
+
+                    int alpha = sharedAlpha.load();
+                    while (score.value() > alpha && !sharedAlpha.compare_exchange_weak(alpha, score.value()));
+                }
+            });
+        }
+
+        for (std::thread &worker: workers) worker.join();
+
+        // results of an aborted iteration are used only if the best move of the previous iteration,
+        // which is always searched first, has been searched and some other move has beaten it
+        if (!scores[0].has_value()) break;
+
+        // only the exact scores are compared, a bound equal to the best score does not make its move as good,
+        // and the first move to finish was always searched with the full window, so some score is exact
+        std::optional<size_t> bestMoveIndex;
+        for (size_t i = 0; i < moves.size(); i++) {
+            if (scores[i].has_value() && scores[i].value() > searchAlphas[i] &&
+                (!bestMoveIndex.has_value() || scores[i].value() > scores[bestMoveIndex.value()].value()))
+                bestMoveIndex = i;
+        }
+        if (!bestMoveIndex.has_value()) break;
+
+        std::swap(moves[0], moves[bestMoveIndex.value()]);
+        this->statistics.score = scores[bestMoveIndex.value()].value();
+
+        if (stopSignal) break;
+
+        this->statistics.depth = depth;
+
+        // saved in the same way as by SearchEngine::findMove, so the next iteration and the principal variation
+        // start with the best move
+        Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+        Game::CellMove canonicalMove = Game::Symmetries::transformMove(
+                Game::CellMove(Game::Bitboards::cellIndex(moves[0].from), Game::Bitboards::cellIndex(moves[0].to)),
+                canonicalKey.symmetry);
+        this->transpositionTable->store(
+                canonicalKey.key,
+                TranspositionEntry(this->statistics.score, depth, ExactBound, canonicalMove.from, canonicalMove.to));
+
+        // there is no need to search deeper once the result of the game is known
+        if (abs(this->statistics.score) >= WIN_SCORE / 2) break;
+    }
+
+    for (const SearchEngine &engine: engines) {
+        this->statistics.nodes += engine.getStatistics().nodes;
+        this->statistics.cutoffs += engine.getStatistics().cutoffs;
+        this->statistics.firstMoveCutoffs += engine.getStatistics().firstMoveCutoffs;
+    }
+
+    return moves[0];
+}
+
+std::optional<Game::Move> ParallelSearchEngine::findMoveWithLazySmp(const Game::Board &board, Game::Side side) {
+    std::atomic<bool> stopSignal{false};
+    std::vector<SearchEngine> engines = createEngines(stopSignal);
+    std::vector<Game::Board> boards(this->threadsCount, board);
+    std::optional<Game::Move> move;
+
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < this->threadsCount; t++) {
+        // half of the helper threads search one ply deeper, so the threads do not follow each other
+        // through the same nodes
+        if (t % 2 == 1) {
+            SearchLimits helperLimits = engines[t].getLimits();
+            helperLimits.depth++;
+            engines[t].setLimits(helperLimits);
+        }
+
+        workers.emplace_back([&, t]() {
+            std::optional<Game::Move> threadMove = engines[t].findMove(boards[t], side);
+
+            // helpers only fill the transposition table, the move is picked by the main thread,
+            // and they are stopped as soon as it finishes
+            if (t == 0) {
+                move = threadMove;
+                stopSignal = true;
+            }
+        });
+    }
+
+    for (std::thread &worker: workers) worker.join();
+
+    this->statistics.depth = engines[0].getStatistics().depth;
+    this->statistics.score = engines[0].getStatistics().score;
+    for (const SearchEngine &engine: engines) {
+        this->statistics.nodes += engine.getStatistics().nodes;
+        this->statistics.cutoffs += engine.getStatistics().cutoffs;
+        this->statistics.firstMoveCutoffs += engine.getStatistics().firstMoveCutoffs;
+    }
+
+    return move;
+}
+
+const SearchStatistics &ParallelSearchEngine::getStatistics() const {
+    return this->statistics;
+}
+
+unsigned int ParallelSearchEngine::getThreadsCount() const {
+    return this->threadsCount;
+}
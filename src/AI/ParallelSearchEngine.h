@@ -0,0 +1,61 @@
+#ifndef PJC_HEXAGON_PARALLELSEARCHENGINE_H
+#define PJC_HEXAGON_PARALLELSEARCHENGINE_H
+
+#include <thread>
+#include "SearchEngine.h"
+
+namespace AI {
+    enum ParallelMode {
+        // moves which can be made in the searched position are distributed between the threads
+        RootSplit = 0,
+        // every thread searches the whole tree, threads help each other through the shared transposition table
+        LazySmp = 1,
+    };
+
+    /**
+     * Runs the \p SearchEngine on multiple threads, every thread searches its own copy of the board.
+     */
+    class ParallelSearchEngine : public Engine {
+    private:
+        SearchLimits limits;
+        ParallelMode mode;
+        unsigned int threadsCount;
+        std::shared_ptr<const Evaluation> evaluation;
+        std::shared_ptr<TranspositionTable> transpositionTable;
+        SearchStatistics statistics;
+
+        /**
+         * Creates an engine for every thread, all of them share the evaluation and the transposition table
+         */
+        std::vector<SearchEngine> createEngines(const std::atomic<bool> &stopSignal) const;
+
+        std::optional<Game::Move> findMoveWithRootSplit(const Game::Board &board, Game::Side side);
+
+        std::optional<Game::Move> findMoveWithLazySmp(const Game::Board &board, Game::Side side);
+
+    public:
+        /**
+         * @param limits Limits of the whole search, the nodes limit is divided between the threads
+         * @param threadsCount If 0, the count of hardware threads is used
+         * @param evaluation If not provided, \p PointsEvaluation is used
+         * @param transpositionTable If not provided, a new one is created
+         */
+        explicit ParallelSearchEngine(
+                SearchLimits limits = SearchLimits(),
+                ParallelMode mode = LazySmp,
+                unsigned int threadsCount = 0,
+                std::shared_ptr<const Evaluation> evaluation = nullptr,
+                std::shared_ptr<TranspositionTable> transpositionTable = nullptr);
+
+        std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) override;
+
+        /**
+         * @return Statistics of the last search, nodes are summed up for all the threads
+         */
+        const SearchStatistics &getStatistics() const;
+
+        unsigned int getThreadsCount() const;
+    };
+}
+
+#endif //PJC_HEXAGON_PARALLELSEARCHENGINE_H
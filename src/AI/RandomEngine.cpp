@@ -0,0 +1,14 @@
+#include "RandomEngine.h"
+
+using namespace AI;
+
+RandomEngine::RandomEngine(std::uint64_t seed) : generator(seed) {}
+
+std::optional<Game::Move> RandomEngine::findMove(Game::Board &board, Game::Side side) {
+    std::vector<Game::MoveWithBorderingStatus> legalMoves = board.findLegalMoves(side, std::nullopt);
+    if (legalMoves.empty()) return std::nullopt;
+
+    std::uniform_int_distribution<size_t> distribution(0, legalMoves.size() - 1);
+
+    return legalMoves[distribution(this->generator)];
+}
@@ -0,0 +1,25 @@
+#ifndef PJC_HEXAGON_RANDOMENGINE_H
+#define PJC_HEXAGON_RANDOMENGINE_H
+
+#include <random>
+#include "Engine.h"
+
+namespace AI {
+    /**
+     * Picks one of the legal moves at random, useful as the weakest possible opponent.
+     */
+    class RandomEngine : public Engine {
+    private:
+        std::mt19937_64 generator;
+
+    public:
+        /**
+         * @param seed Engines created with the same seed pick the same moves in the same positions
+         */
+        explicit RandomEngine(std::uint64_t seed = std::random_device()());
+
+        std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) override;
+    };
+}
+
+#endif //PJC_HEXAGON_RANDOMENGINE_H
@@ -0,0 +1,289 @@
+#include "SearchEngine.h"
+
+using namespace AI;
+
+SearchLimits::SearchLimits(short depth, std::chrono::milliseconds time, unsigned long long nodes) {
+    this->depth = depth;
+    this->time = time;
+    this->nodes = nodes;
+}
+
+double SearchStatistics::getFirstMoveCutoffRate() const {
+    return this->cutoffs == 0 ? 0 : static_cast<double>(this->firstMoveCutoffs) / static_cast<double>(this->cutoffs);
+}
+
+SearchEngine::SearchEngine(
+        SearchLimits limits,
+        std::shared_ptr<const Evaluation> evaluation,
+        std::shared_ptr<TranspositionTable> transpositionTable) {
+    this->limits = limits;
+    this->evaluation = evaluation != nullptr ? std::move(evaluation) : std::make_shared<PointsEvaluation>();
+    this->transpositionTable = transpositionTable != nullptr
+                               ? std::move(transpositionTable)
+                               : std::make_shared<TranspositionTable>();
+}
+
+std::optional<Game::Move> SearchEngine::findMove(Game::Board &board, Game::Side side) {
+    beginSearch();
+
+    std::vector<Game::MoveWithBorderingStatus> moves = board.findLegalMoves(side, std::nullopt);
+    if (moves.empty()) return std::nullopt;
+
+    for (short depth = 1; depth <= this->limits.depth; depth++) {
+        int alpha = -SCORE_INFINITY;
+        size_t bestMoveIndex = 0;
+
+        for (size_t i = 0; i < moves.size(); i++) {
+            std::optional<int> score = searchMove(
+                    board,
+                    side,
+                    Game::Bitboards::cellIndex(moves[i].from),
+                    Game::Bitboards::cellIndex(moves[i].to),
+                    depth,
+                    alpha);
+
+            if (!score.has_value()) break;
+
+            if (score.value() > alpha) {
+                alpha = score.value();
+                bestMoveIndex = i;
+            }
+        }
+
+        // results of an aborted iteration are used only if it has found a better move than the previous one,
+        // which is always searched first
+        if (this->aborted && bestMoveIndex == 0) break;
+
+        // the best move is searched first in the next iteration, which results in more cutoffs
+        std::swap(moves[0], moves[bestMoveIndex]);
+        this->statistics.score = alpha;
+
+        if (this->aborted) break;
+
+        this->statistics.depth = depth;
+
+        Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+        Game::CellMove canonicalMove = Game::Symmetries::transformMove(
+                Game::CellMove(Game::Bitboards::cellIndex(moves[0].from), Game::Bitboards::cellIndex(moves[0].to)),
+                canonicalKey.symmetry);
+        this->transpositionTable->store(
+                canonicalKey.key,
+                TranspositionEntry(scoreToTable(alpha, 0), depth, ExactBound, canonicalMove.from, canonicalMove.to));
+
+        if (this->iterationCallback) {
+            this->statistics.time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - this->searchStart);
+            this->iterationCallback(this->statistics);
+        }
+
+        // there is no need to search deeper once the result of the game is known
+        if (abs(alpha) >= WIN_SCORE / 2) break;
+    }
+
+    this->statistics.time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - this->searchStart);
+
+    return moves[0];
+}
+
+void SearchEngine::beginSearch() {
+    this->statistics = SearchStatistics();
+    this->searchStart = std::chrono::steady_clock::now();
+    this->aborted = false;
+    this->moveOrdering.newSearch();
+}
+
+std::optional<int> SearchEngine::searchMove(
+        Game::Board &board,
+        Game::Side side,
+        short from,
+        short to,
+        short depth,
+        int alpha) {
+    Game::UndoRecord undoRecord = board.makeMoveUnchecked(side, from, to);
+    int score = -negamax(board, Game::Team::oppositeSide(side), static_cast<short>(depth - 1), 1,
+                         -SCORE_INFINITY, -alpha);
+    board.unmakeMove(undoRecord);
+
+    if (this->aborted) return std::nullopt;
+
+    return score;
+}
+
+int SearchEngine::negamax(Game::Board &board, Game::Side side, short depth, short ply, int alpha, int beta) {
+    if (isBudgetExceeded()) return 0;
+
+    if (board.isGameFinished()) return evaluateFinishedGame(board, side, ply);
+
+    if (depth <= 0) return this->evaluation->evaluate(board, side);
+
+    // equivalent positions share the entries, their moves are saved as the moves of the canonical position
+    Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+    std::optional<TranspositionEntry> entry = this->transpositionTable->probe(canonicalKey.key);
+
+    if (entry.has_value() && entry->depth >= depth) {
+        int score = scoreFromTable(entry->score, ply);
+
+        if (entry->bound == ExactBound) return score;
+        if (entry->bound == LowerBound && score >= beta) return score;
+        if (entry->bound == UpperBound && score <= alpha) return score;
+    }
+
+    Game::Side enemySide = Game::Team::oppositeSide(side);
+    Game::MoveBuffer moves;
+    short movesCount = board.generateMoves(side, moves);
+
+    // side which cannot make a move skips its turn
+    if (movesCount == 0)
+        return -negamax(board, enemySide, static_cast<short>(depth - 1), static_cast<short>(ply + 1), -beta, -alpha);
+
+    // the best move found in the previous search of the position is searched first
+    std::optional<Game::CellMove> hashMove;
+    if (entry.has_value() && entry->from != NO_MOVE_CELL)
+        hashMove = Game::Symmetries::transformMove(Game::CellMove(entry->from, entry->to), canonicalKey.symmetry);
+
+    MoveScores scores;
+    this->moveOrdering.scoreMoves(board, side, moves, movesCount, ply, hashMove, scores);
+
+    int originalAlpha = alpha;
+    int bestScore = -SCORE_INFINITY;
+    short bestFrom = NO_MOVE_CELL;
+    short bestTo = NO_MOVE_CELL;
+
+    for (short i = 0; i < movesCount; i++) {
+        MoveOrdering::pickMove(moves, scores, i, movesCount);
+        short from = moves[i].from;
+        short to = moves[i].to;
+
+        Game::UndoRecord undoRecord = board.makeMoveUnchecked(side, from, to);
+        int score = -negamax(board, enemySide, static_cast<short>(depth - 1), static_cast<short>(ply + 1),
+                             -beta, -alpha);
+        board.unmakeMove(undoRecord);
+
+        if (this->aborted) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestFrom = from;
+            bestTo = to;
+        }
+        if (score > alpha) alpha = score;
+        if (alpha >= beta) {
+            this->statistics.cutoffs++;
+            if (i == 0) this->statistics.firstMoveCutoffs++;
+            this->moveOrdering.recordCutoff(moves[i], ply, depth);
+            break;
+        }
+    }
+
+    BoundType bound = ExactBound;
+    if (bestScore <= originalAlpha) bound = UpperBound;
+    else if (bestScore >= beta) bound = LowerBound;
+
+    if (bestFrom != NO_MOVE_CELL) {
+        bestFrom = Game::Symmetries::transformCell(bestFrom, canonicalKey.symmetry);
+        bestTo = Game::Symmetries::transformCell(bestTo, canonicalKey.symmetry);
+    }
+    this->transpositionTable->store(
+            canonicalKey.key,
+            TranspositionEntry(scoreToTable(bestScore, ply), depth, bound, bestFrom, bestTo));
+
+    return bestScore;
+}
+
+int SearchEngine::evaluateFinishedGame(const Game::Board &board, Game::Side side, short ply) {
+    Game::Points points = board.getPoints();
+    int sidePoints = points.getTeamPoints(side);
+    int enemyPoints = points.getTeamPoints(Game::Team::oppositeSide(side));
+
+    // when one of the sides loses all the pawns the other one wins, even if it has less points at the moment
+    if (sidePoints == 0) return -WIN_SCORE + ply - enemyPoints;
+    if (enemyPoints == 0) return WIN_SCORE - ply + sidePoints;
+
+    if (sidePoints > enemyPoints) return WIN_SCORE - ply + sidePoints - enemyPoints;
+    if (sidePoints < enemyPoints) return -WIN_SCORE + ply + sidePoints - enemyPoints;
+
+    return 0;
+}
+
+int SearchEngine::scoreToTable(int score, short ply) {
+    if (score > WIN_SCORE / 2) return score + ply;
+    if (score < -WIN_SCORE / 2) return score - ply;
+    return score;
+}
+
+int SearchEngine::scoreFromTable(int score, short ply) {
+    if (score > WIN_SCORE / 2) return score - ply;
+    if (score < -WIN_SCORE / 2) return score + ply;
+    return score;
+}
+
+bool SearchEngine::isBudgetExceeded() {
+    this->statistics.nodes++;
+
+    if (this->limits.nodes != 0 && this->statistics.nodes >= this->limits.nodes) this->aborted = true;
+
+    if (this->stopSignal != nullptr && this->stopSignal->load(std::memory_order_relaxed)) this->aborted = true;
+
+    // checking the clock is much slower than visiting a node, so it is done only every 1024 nodes
+    if (this->limits.time.count() != 0 && (this->statistics.nodes & 1023) == 0 &&
+        std::chrono::steady_clock::now() - this->searchStart >= this->limits.time)
+        this->aborted = true;
+
+    return this->aborted;
+}
+
+const SearchStatistics &SearchEngine::getStatistics() const {
+    return this->statistics;
+}
+
+const SearchLimits &SearchEngine::getLimits() const {
+    return this->limits;
+}
+
+void SearchEngine::setLimits(SearchLimits _limits) {
+    this->limits = _limits;
+}
+
+void SearchEngine::setStopSignal(const std::atomic<bool> *_stopSignal) {
+    this->stopSignal = _stopSignal;
+}
+
+void SearchEngine::setIterationCallback(std::function<void(const SearchStatistics &)> _iterationCallback) {
+    this->iterationCallback = std::move(_iterationCallback);
+}
+
+std::vector<Game::Move> SearchEngine::findPrincipalVariation(
+        Game::Board board,
+        Game::Side side,
+        short maxLength) const {
+    std::vector<Game::Move> principalVariation;
+
+    while (static_cast<short>(principalVariation.size()) < maxLength && !board.isGameFinished()) {
+        Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+        std::optional<TranspositionEntry> entry = this->transpositionTable->probe(canonicalKey.key);
+        if (!entry.has_value() || entry->from == NO_MOVE_CELL) break;
+
+        Game::CellMove cellMove = Game::Symmetries::transformMove(Game::CellMove(entry->from, entry->to),
+                                                                  canonicalKey.symmetry);
+        Game::Move move(
+                Game::MoveUnit(Game::Bitboards::cellRow(cellMove.from), Game::Bitboards::cellUiColumn(cellMove.from)),
+                Game::MoveUnit(Game::Bitboards::cellRow(cellMove.to), Game::Bitboards::cellUiColumn(cellMove.to)));
+        // positions with colliding hashes share the entries, so the moves are verified
+        if (!board.isMoveLegal(side, move)) break;
+
+        board.makeMove(side, move);
+        principalVariation.emplace_back(move);
+        side = Game::Team::oppositeSide(side);
+    }
+
+    return principalVariation;
+}
+
+bool SearchEngine::isAborted() const {
+    return this->aborted;
+}
+
+const std::shared_ptr<TranspositionTable> &SearchEngine::getTranspositionTable() const {
+    return this->transpositionTable;
+}
@@ -0,0 +1,158 @@
+#ifndef PJC_HEXAGON_SEARCHENGINE_H
+#define PJC_HEXAGON_SEARCHENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "Engine.h"
+#include "Evaluation.h"
+#include "MoveOrdering.h"
+#include "TranspositionTable.h"
+
+namespace AI {
+    // bounds for scores returned by the search
+    const int SCORE_INFINITY = 1000000;
+    // score of a won game, lowered by the count of plies needed for the win, so the faster wins are preferred
+    const int WIN_SCORE = 100000;
+
+    /**
+     * Budget of a single search, the search stops when any of the limits is reached
+     */
+    class SearchLimits {
+    public:
+        // maximal depth reached by the iterative deepening
+        short depth = 4;
+        // zero means that the time is not limited
+        std::chrono::milliseconds time = std::chrono::milliseconds(0);
+        // zero means that the count of visited nodes is not limited
+        unsigned long long nodes = 0;
+
+        SearchLimits() = default;
+
+        SearchLimits(short depth, std::chrono::milliseconds time, unsigned long long nodes);
+    };
+
+    /**
+     * Information about the last finished search
+     */
+    class SearchStatistics {
+    public:
+        unsigned long long nodes = 0;
+        // depth of the last iteration which was fully searched
+        short depth = 0;
+        // score of the picked move from the perspective of the side making it
+        int score = 0;
+        std::chrono::milliseconds time = std::chrono::milliseconds(0);
+        // nodes in which a move caused a cutoff, and the ones in which it was the first searched move
+        unsigned long long cutoffs = 0;
+        unsigned long long firstMoveCutoffs = 0;
+
+        /**
+         * @return Share of the cutoffs caused by the first searched move, the closer to 1 the better the moves
+         * are ordered
+         */
+        double getFirstMoveCutoffRate() const;
+    };
+
+    /**
+     * Negamax search with alpha-beta pruning and iterative deepening, used by the computer team.
+     * Moves are made and unmade on the searched board, so no copies of the board are created.
+     */
+    class SearchEngine : public Engine {
+    private:
+        SearchLimits limits;
+        std::shared_ptr<const Evaluation> evaluation;
+        std::shared_ptr<TranspositionTable> transpositionTable;
+        SearchStatistics statistics;
+        MoveOrdering moveOrdering;
+        std::chrono::steady_clock::time_point searchStart;
+        bool aborted = false;
+        // set from the outside in order to abort the search, e.g. by other threads
+        const std::atomic<bool> *stopSignal = nullptr;
+        // called after every fully searched iteration of the iterative deepening
+        std::function<void(const SearchStatistics &)> iterationCallback;
+
+        /**
+         * @return Score of the \p board from the perspective of the \p side
+         */
+        int negamax(Game::Board &board, Game::Side side, short depth, short ply, int alpha, int beta);
+
+        /**
+         * @return Score of a board on which the game has already finished
+         */
+        static int evaluateFinishedGame(const Game::Board &board, Game::Side side, short ply);
+
+        /**
+         * Scores of won and lost games depend on the ply at which they were found, so before saving them
+         * in the transposition table they are converted to be relative to the saved position
+         */
+        static int scoreToTable(int score, short ply);
+
+        static int scoreFromTable(int score, short ply);
+
+        /**
+         * Counts the visited node and checks the limits, once they are exceeded the search gets aborted
+         */
+        bool isBudgetExceeded();
+
+    public:
+        /**
+         * @param evaluation If not provided, \p PointsEvaluation is used
+         * @param transpositionTable Can be shared between multiple engines, if not provided a new one is created
+         */
+        explicit SearchEngine(
+                SearchLimits limits = SearchLimits(),
+                std::shared_ptr<const Evaluation> evaluation = nullptr,
+                std::shared_ptr<TranspositionTable> transpositionTable = nullptr);
+
+        std::optional<Game::Move> findMove(Game::Board &board, Game::Side side) override;
+
+        /**
+         * Resets the statistics and starts measuring the time, has to be called before the first \p searchMove
+         * of a search
+         */
+        void beginSearch();
+
+        /**
+         * Searches a single move made in the root position, allows splitting the root moves between threads
+         * @param from Index of the field from which the pawn is moved
+         * @param to Index of the field to which the pawn is moved
+         * @param alpha Score which the move has to beat, scores equal or lower than it are only upper bounds
+         * @return Score of the move from the perspective of the \p side, null option if the search got aborted
+         */
+        std::optional<int> searchMove(Game::Board &board, Game::Side side, short from, short to, short depth,
+                                      int alpha);
+
+        /**
+         * @param _stopSignal Once it's set to true the search gets aborted, as if the limits were reached
+         */
+        void setStopSignal(const std::atomic<bool> *_stopSignal);
+
+        /**
+         * @param _iterationCallback Receives the statistics after every finished iteration of \p findMove,
+         * called on the searching thread
+         */
+        void setIterationCallback(std::function<void(const SearchStatistics &)> _iterationCallback);
+
+        bool isAborted() const;
+
+        /**
+         * Follows the best moves saved in the transposition table, starting in the passed position.
+         * @param maxLength Maximal count of the returned moves
+         * @return Moves expected to be played, empty if the position has not been searched
+         */
+        std::vector<Game::Move> findPrincipalVariation(Game::Board board, Game::Side side, short maxLength) const;
+
+        const std::shared_ptr<TranspositionTable> &getTranspositionTable() const;
+
+        const SearchStatistics &getStatistics() const;
+
+        const SearchLimits &getLimits() const;
+
+        void setLimits(SearchLimits _limits);
+    };
+}
+
+#endif //PJC_HEXAGON_SEARCHENGINE_H
@@ -0,0 +1,75 @@
+#include "TranspositionTable.h"
+
+using namespace AI;
+
+TranspositionEntry::TranspositionEntry(int score, short depth, BoundType bound, short from, short to) {
+    this->score = score;
+    this->depth = depth;
+    this->bound = bound;
+    this->from = from;
+    this->to = to;
+}
+
+TranspositionTable::TranspositionTable(std::size_t sizeInMegabytes) {
+    std::size_t slotsCount = 1;
+    while (slotsCount * 2 * sizeof(Slot) <= sizeInMegabytes * 1024 * 1024) slotsCount *= 2;
+
+    this->slots = std::make_unique<Slot[]>(slotsCount);
+    this->slotsMask = slotsCount - 1;
+}
+
+// data scheme, from the lowest bits: {score: 32}{depth: 8}{bound: 2}{from: 7}{to: 7}{used: 1}
+std::uint64_t TranspositionTable::packEntry(const TranspositionEntry &entry) {
+    return static_cast<std::uint32_t>(entry.score)
+           | static_cast<std::uint64_t>(entry.depth & 0xFF) << 32
+           | static_cast<std::uint64_t>(entry.bound & 0x3) << 40
+           | static_cast<std::uint64_t>(entry.from & 0x7F) << 42
+           | static_cast<std::uint64_t>(entry.to & 0x7F) << 49
+           | static_cast<std::uint64_t>(1) << 56;
+}
+
+TranspositionEntry TranspositionTable::unpackEntry(std::uint64_t data) {
+    return {static_cast<std::int32_t>(static_cast<std::uint32_t>(data)),
+            static_cast<short>(static_cast<std::int8_t>((data >> 32) & 0xFF)),
+            static_cast<BoundType>((data >> 40) & 0x3),
+            static_cast<short>((data >> 42) & 0x7F),
+            static_cast<short>((data >> 49) & 0x7F)};
+}
+
+std::optional<TranspositionEntry> TranspositionTable::probe(std::uint64_t hash) const {
+    const Slot &slot = this->slots[hash & this->slotsMask];
+
+    std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+    std::uint64_t verification = slot.verification.load(std::memory_order_relaxed);
+
+    if (data == 0 || (verification ^ data) != hash) return std::nullopt;
+
+    return unpackEntry(data);
+}
+
+void TranspositionTable::store(std::uint64_t hash, const TranspositionEntry &entry) {
+    Slot &slot = this->slots[hash & this->slotsMask];
+
+    std::uint64_t storedData = slot.data.load(std::memory_order_relaxed);
+    std::uint64_t storedVerification = slot.verification.load(std::memory_order_relaxed);
+
+    if (storedData != 0 && (storedVerification ^ storedData) == hash &&
+        unpackEntry(storedData).depth > entry.depth)
+        return;
+
+    std::uint64_t data = packEntry(entry);
+
+    slot.verification.store(hash ^ data, std::memory_order_relaxed);
+    slot.data.store(data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::clear() {
+    for (std::uint64_t i = 0; i <= this->slotsMask; i++) {
+        this->slots[i].verification.store(0, std::memory_order_relaxed);
+        this->slots[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t TranspositionTable::getSize() const {
+    return this->slotsMask + 1;
+}
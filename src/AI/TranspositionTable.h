@@ -0,0 +1,79 @@
+#ifndef PJC_HEXAGON_TRANSPOSITIONTABLE_H
+#define PJC_HEXAGON_TRANSPOSITIONTABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace AI {
+    enum BoundType {
+        ExactBound = 0,
+        // the actual score is at least the stored one, search of the node has been cut off
+        LowerBound = 1,
+        // the actual score is at most the stored one, no move has raised alpha
+        UpperBound = 2,
+    };
+
+    // stored instead of a field index when the entry has no best move
+    const short NO_MOVE_CELL = 127;
+
+    class TranspositionEntry {
+    public:
+        int score;
+        short depth;
+        BoundType bound;
+        // indexes of the fields of the best move found in the position, \p NO_MOVE_CELL if there is none
+        short from;
+        short to;
+
+        TranspositionEntry() = default;
+
+        TranspositionEntry(int score, short depth, BoundType bound, short from, short to);
+    };
+
+    /**
+     * Fixed size hash table of the searched positions, indexed with the boards' Zobrist hashes.
+     * Table can be shared by multiple searching threads without any locks: every entry is stored as two
+     * 64-bit words, and the first one holds the hash xor-ed with the second one, so entries torn by concurrent
+     * writes fail the verification on probe and are treated as missing.
+     */
+    class TranspositionTable {
+    private:
+        class Slot {
+        public:
+            std::atomic<std::uint64_t> verification{0};
+            std::atomic<std::uint64_t> data{0};
+        };
+
+        std::unique_ptr<Slot[]> slots;
+        std::uint64_t slotsMask;
+
+        static std::uint64_t packEntry(const TranspositionEntry &entry);
+
+        static TranspositionEntry unpackEntry(std::uint64_t data);
+
+    public:
+        /**
+         * @param sizeInMegabytes Size of the table, rounded down to a power of two count of entries
+         */
+        explicit TranspositionTable(std::size_t sizeInMegabytes = 16);
+
+        /**
+         * @return Entry saved for the \p hash, null option if there is none
+         */
+        std::optional<TranspositionEntry> probe(std::uint64_t hash) const;
+
+        /**
+         * Saves the entry, entries of other positions are always replaced, while the entries of the same position
+         * are replaced only by the ones searched at least as deep
+         */
+        void store(std::uint64_t hash, const TranspositionEntry &entry);
+
+        void clear();
+
+        std::size_t getSize() const;
+    };
+}
+
+#endif //PJC_HEXAGON_TRANSPOSITIONTABLE_H
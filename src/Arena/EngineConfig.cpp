@@ -0,0 +1,103 @@
+#include "EngineConfig.h"
+#include <sstream>
+#include <vector>
+#include "../AI/BookEngine.h"
+#include "../AI/EndgameSolver.h"
+#include "../AI/GreedyEngine.h"
+#include "../AI/MctsEngine.h"
+#include "../AI/RandomEngine.h"
+#include "../AI/SearchEngine.h"
+
+using namespace Arena;
+
+// the description has no room for the solver's limits, as the rest of it describes the fallback engine, so the
+// solver always gets the same time for a move, and a small table since many games can be played at the same time
+const std::chrono::milliseconds ENDGAME_TIME_LIMIT(1000);
+const std::size_t ENDGAME_TABLE_SIZE_IN_MEGABYTES = 4;
+
+EngineConfig::EngineConfig(std::string name, std::function<std::unique_ptr<AI::Engine>(std::uint64_t)> create)
+        : name(std::move(name)), create(std::move(create)) {}
+
+std::optional<EngineConfig> EngineConfig::parse(const std::string &description) {
+    std::vector<std::string> parts;
+    std::stringstream descriptionStream(description);
+    std::string part;
+    while (std::getline(descriptionStream, part, ':')) parts.emplace_back(part);
+
+    if (parts.empty()) return std::nullopt;
+
+    // wraps any other engine, which plays the positions that are not solved
+    if (parts[0] == "endgame" && parts.size() >= 3) {
+        short threshold;
+
+        try {
+            threshold = static_cast<short>(std::stoi(parts[1]));
+        } catch (const std::exception &) {
+            return std::nullopt;
+        }
+
+        std::optional<EngineConfig> fallback = parse(description.substr(parts[0].size() + parts[1].size() + 2));
+        if (threshold < 0 || !fallback.has_value()) return std::nullopt;
+
+        return EngineConfig(description, [threshold, fallback](std::uint64_t seed) {
+            return std::make_unique<AI::EndgameSolver>(fallback->create(seed), threshold, ENDGAME_TIME_LIMIT,
+                                                       ENDGAME_TABLE_SIZE_IN_MEGABYTES);
+        });
+    }
+
+    // the book is opened once and shared by the engines of all the games
+    if (parts[0] == "book" && parts.size() >= 3) {
+        std::optional<FileManagement::OpeningBook> openedBook = FileManagement::OpeningBook::open(parts[1]);
+        std::optional<EngineConfig> fallback = parse(description.substr(parts[0].size() + parts[1].size() + 2));
+        if (!openedBook.has_value() || !fallback.has_value()) return std::nullopt;
+
+        auto book = std::make_shared<const FileManagement::OpeningBook>(std::move(openedBook.value()));
+        return EngineConfig(description, [book, fallback](std::uint64_t seed) {
+            return std::make_unique<AI::BookEngine>(book, fallback->create(seed));
+        });
+    }
+
+    if (parts[0] == "greedy" && parts.size() == 1)
+        return EngineConfig(description, [](std::uint64_t) { return std::make_unique<AI::GreedyEngine>(); });
+
+    if (parts[0] == "random" && parts.size() == 1)
+        return EngineConfig(description, [](std::uint64_t seed) { return std::make_unique<AI::RandomEngine>(seed); });
+
+    if (parts[0] == "search" && (parts.size() == 2 || parts.size() == 3)) {
+        AI::SearchLimits limits;
+
+        try {
+            limits.depth = static_cast<short>(std::stoi(parts[1]));
+            if (parts.size() == 3) limits.time = std::chrono::milliseconds(std::stoll(parts[2]));
+        } catch (const std::exception &) {
+            return std::nullopt;
+        }
+
+        if (limits.depth <= 0) return std::nullopt;
+
+        return EngineConfig(description, [limits](std::uint64_t) {
+            // small table is enough for the short searches, and many games can be played at the same time
+            return std::make_unique<AI::SearchEngine>(limits, nullptr, std::make_shared<AI::TranspositionTable>(4));
+        });
+    }
+
+    if (parts[0] == "mcts" && (parts.size() == 2 || parts.size() == 3)) {
+        AI::MctsLimits limits;
+
+        try {
+            limits.playouts = std::stoull(parts[1]);
+            limits.time = std::chrono::milliseconds(parts.size() == 3 ? std::stoll(parts[2]) : 0);
+        } catch (const std::exception &) {
+            return std::nullopt;
+        }
+
+        if (limits.playouts == 0 && limits.time.count() == 0) return std::nullopt;
+
+        return EngineConfig(description, [limits](std::uint64_t seed) {
+            // the tree of a single search never gets bigger than a few nodes per playout
+            return std::make_unique<AI::MctsEngine>(limits, 1 << 16, seed);
+        });
+    }
+
+    return std::nullopt;
+}
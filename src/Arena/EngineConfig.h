@@ -0,0 +1,40 @@
+#ifndef PJC_HEXAGON_ENGINECONFIG_H
+#define PJC_HEXAGON_ENGINECONFIG_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include "../AI/Engine.h"
+
+namespace Arena {
+    /**
+     * Description of an engine taking part in the tournament, every game gets its own instance of the engine,
+     * so the games can be played in parallel.
+     */
+    class EngineConfig {
+    public:
+        std::string name;
+        // creates a new instance of the engine, the seed is used by the engines picking the moves at random
+        std::function<std::unique_ptr<AI::Engine>(std::uint64_t seed)> create;
+
+        EngineConfig(std::string name, std::function<std::unique_ptr<AI::Engine>(std::uint64_t seed)> create);
+
+        /**
+         * Supported descriptions:
+         * greedy - \p AI::GreedyEngine
+         * random - \p AI::RandomEngine
+         * search:depth[:milliseconds] - \p AI::SearchEngine limited to the depth and optionally to the time
+         * mcts:playouts[:milliseconds] - \p AI::MctsEngine limited to the playouts and optionally to the time
+         * endgame:emptyFields:engine - \p AI::EndgameSolver solving the positions with at most the empty fields,
+         * the other positions are played by the engine given by the rest of the description
+         * book:file:engine - \p AI::BookEngine playing the moves of the opening book saved in the file, the other
+         * positions are played by the engine given by the rest of the description
+         * @return Null option if the \p description is not valid
+         */
+        static std::optional<EngineConfig> parse(const std::string &description);
+    };
+}
+
+#endif //PJC_HEXAGON_ENGINECONFIG_H
@@ -0,0 +1,195 @@
+#include "Tournament.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <thread>
+#include "../AI/RandomEngine.h"
+
+using namespace Arena;
+
+unsigned int TournamentResults::getGamesCount() const {
+    return this->wins + this->draws + this->losses;
+}
+
+double TournamentResults::getScore() const {
+    if (getGamesCount() == 0) return 0.5;
+
+    return (this->wins + 0.5 * this->draws) / getGamesCount();
+}
+
+namespace {
+    double eloDifferenceByScore(double score) {
+        if (score <= 0) return -std::numeric_limits<double>::infinity();
+        if (score >= 1) return std::numeric_limits<double>::infinity();
+
+        return 400 * std::log10(score / (1 - score));
+    }
+}
+
+double TournamentResults::getEloDifference() const {
+    return eloDifferenceByScore(getScore());
+}
+
+double TournamentResults::getEloErrorMargin() const {
+    unsigned int gamesCount = getGamesCount();
+    if (gamesCount == 0 || !std::isfinite(getEloDifference())) return std::numeric_limits<double>::infinity();
+
+    double score = getScore();
+    double variance = (this->wins * std::pow(1 - score, 2) + this->draws * std::pow(0.5 - score, 2) +
+                       this->losses * std::pow(score, 2)) / gamesCount;
+    // 1.96 standard errors on both sides of the score cover 95% of the normal distribution
+    double scoreMargin = 1.96 * std::sqrt(variance / gamesCount);
+
+    return (eloDifferenceByScore(score + scoreMargin) - eloDifferenceByScore(score - scoreMargin)) / 2;
+}
+
+Tournament::Tournament(
+        EngineConfig firstEngine,
+        EngineConfig secondEngine,
+        std::vector<Opening> openings,
+        unsigned int threadsCount,
+        std::uint64_t seed)
+        : firstEngine(std::move(firstEngine)), secondEngine(std::move(secondEngine)), openings(std::move(openings)),
+          threadsCount(threadsCount != 0 ? threadsCount : std::max(std::thread::hardware_concurrency(), 1u)),
+          seed(seed) {}
+
+GameResult Tournament::playGame(
+        Game::Board &board,
+        Game::Side side,
+        AI::Engine &red,
+        AI::Engine &blue,
+        FileManagement::MoveLogWriter *moveLog) {
+    GameResult result;
+    bool previousSideSkipped = false;
+
+    while (!board.isGameFinished() && result.plies < MAX_GAME_PLIES) {
+        AI::Engine &engine = side == Game::RedSide ? red : blue;
+        std::optional<Game::Move> move = engine.findMove(board, side);
+
+        if (move.has_value()) {
+            board.makeMove(side, move.value());
+            previousSideSkipped = false;
+        } else if (previousSideSkipped) break;
+        else previousSideSkipped = true;
+
+        board.fillBoardIfSideEliminated();
+        side = Game::Team::oppositeSide(side);
+        result.plies++;
+
+        if (moveLog != nullptr) moveLog->recordMove(board, move);
+    }
+
+    Game::Points points = board.getPoints();
+    result.redPoints = static_cast<short>(points.getTeamPoints(Game::RedSide));
+    result.bluePoints = static_cast<short>(points.getTeamPoints(Game::BlueSide));
+
+    return result;
+}
+
+std::vector<Opening> Tournament::createRandomOpenings(unsigned int count, unsigned int plies, std::uint64_t seed) {
+    std::vector<Opening> randomOpenings;
+    AI::RandomEngine engine(seed);
+
+    for (unsigned int i = 0; i < count; i++) {
+        Opening opening;
+        Game::Board board;
+        Game::Side side = Game::RedSide;
+
+        for (unsigned int ply = 0; ply < plies && !board.isGameFinished(); ply++) {
+            std::optional<Game::Move> move = engine.findMove(board, side);
+            if (!move.has_value()) break;
+
+            // the openings are replayed the same way, so the next move is picked from the same position
+            board.makeMove(side, move.value());
+            board.fillBoardIfSideEliminated();
+            opening.emplace_back(move.value());
+            side = Game::Team::oppositeSide(side);
+        }
+
+        randomOpenings.emplace_back(opening);
+    }
+
+    return randomOpenings;
+}
+
+GameResult Tournament::playGame(unsigned int gameIndex, bool isRecorded) const {
+    Game::Board board;
+    Game::Side side = Game::RedSide;
+
+    std::ostringstream moveLogStream;
+    std::optional<FileManagement::MoveLogWriter> moveLog;
+    if (isRecorded) {
+        moveLog.emplace(moveLogStream);
+        moveLog->beginGame(
+                Game::Teams(Game::Team(Game::RedSide, Game::Computer), Game::Team(Game::BlueSide, Game::Computer)),
+                side,
+                board);
+    }
+
+    if (!this->openings.empty()) {
+        for (const Game::Move &move: this->openings[(gameIndex / 2) % this->openings.size()]) {
+            board.makeMove(side, move);
+            board.fillBoardIfSideEliminated();
+            side = Game::Team::oppositeSide(side);
+
+            if (moveLog.has_value()) moveLog->recordMove(board, move);
+        }
+    }
+
+    std::unique_ptr<AI::Engine> first = this->firstEngine.create(this->seed + 2 * gameIndex);
+    std::unique_ptr<AI::Engine> second = this->secondEngine.create(this->seed + 2 * gameIndex + 1);
+    FileManagement::MoveLogWriter *moveLogPointer = moveLog.has_value() ? &moveLog.value() : nullptr;
+
+    GameResult result = gameIndex % 2 == 0
+                        ? playGame(board, side, *first, *second, moveLogPointer)
+                        : playGame(board, side, *second, *first, moveLogPointer);
+
+    if (moveLog.has_value()) {
+        moveLog->endGame();
+        result.moveLog = moveLogStream.str();
+    }
+
+    return result;
+}
+
+TournamentResults Tournament::run(unsigned int gamesCount, std::ostream *moveLog) const {
+    std::vector<GameResult> gameResults(gamesCount);
+    std::atomic<unsigned int> nextGame{0};
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < std::min(this->threadsCount, gamesCount); i++) {
+        threads.emplace_back([&]() {
+            // every game writes only to its own result, so no synchronization is needed apart from the counter
+            for (unsigned int game = nextGame++; game < gamesCount; game = nextGame++)
+                gameResults[game] = playGame(game, moveLog != nullptr);
+        });
+    }
+
+    for (std::thread &thread: threads) thread.join();
+
+    TournamentResults results;
+    results.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (unsigned int game = 0; game < gamesCount; game++) {
+        const GameResult &gameResult = gameResults[game];
+        short firstEnginePoints = game % 2 == 0 ? gameResult.redPoints : gameResult.bluePoints;
+        short secondEnginePoints = game % 2 == 0 ? gameResult.bluePoints : gameResult.redPoints;
+
+        if (firstEnginePoints > secondEnginePoints) results.wins++;
+        else if (firstEnginePoints < secondEnginePoints) results.losses++;
+        else results.draws++;
+
+        results.plies += gameResult.plies;
+
+        // games are played in parallel, but they are written in order
+        if (moveLog != nullptr)
+            moveLog->write(gameResult.moveLog.data(), static_cast<std::streamsize>(gameResult.moveLog.size()));
+    }
+
+    return results;
+}
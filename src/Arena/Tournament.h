@@ -0,0 +1,110 @@
+#ifndef PJC_HEXAGON_TOURNAMENT_H
+#define PJC_HEXAGON_TOURNAMENT_H
+
+#include <vector>
+#include "EngineConfig.h"
+#include "../Game/Board.h"
+#include "../FileManagement/MoveLog.h"
+
+namespace Arena {
+    // games longer than this are finished early and decided by the points
+    const unsigned int MAX_GAME_PLIES = 400;
+
+    /**
+     * Moves played from the initial position before the engines take over
+     */
+    typedef std::vector<Game::Move> Opening;
+
+    class GameResult {
+    public:
+        short redPoints = 0;
+        short bluePoints = 0;
+        // count of plies played by the engines, without the opening
+        unsigned int plies = 0;
+        // game written in the move log format, empty if the games are not recorded
+        std::string moveLog;
+    };
+
+    class TournamentResults {
+    public:
+        // counted from the perspective of the first engine
+        unsigned int wins = 0;
+        unsigned int draws = 0;
+        unsigned int losses = 0;
+        unsigned long long plies = 0;
+        double seconds = 0;
+
+        unsigned int getGamesCount() const;
+
+        /**
+         * @return Part of the points scored by the first engine, where a win is worth 1 and a draw is worth 0.5
+         */
+        double getScore() const;
+
+        /**
+         * @return Elo difference between the first and the second engine, infinite if one of them won all the games
+         */
+        double getEloDifference() const;
+
+        /**
+         * @return Half of the width of the 95% confidence interval of the \p getEloDifference, infinite when
+         * the interval is not bounded
+         */
+        double getEloErrorMargin() const;
+    };
+
+    /**
+     * Plays games between two engines without any UI.
+     */
+    class Tournament {
+    private:
+        EngineConfig firstEngine;
+        EngineConfig secondEngine;
+        std::vector<Opening> openings;
+        unsigned int threadsCount;
+        std::uint64_t seed;
+
+        /**
+         * Every opening is played twice, so both engines play it as red and as blue, the first engine plays
+         * as red in the games with even indexes
+         * @param isRecorded Whether the game should be written to the \p GameResult::moveLog
+         */
+        GameResult playGame(unsigned int gameIndex, bool isRecorded) const;
+
+    public:
+        /**
+         * @param openings Openings used for the games, if empty all the games start from the initial position
+         * @param threadsCount Count of games played at the same time, if 0 the count of hardware threads is used
+         * @param seed Seed of the engines picking the moves at random
+         */
+        Tournament(
+                EngineConfig firstEngine,
+                EngineConfig secondEngine,
+                std::vector<Opening> openings,
+                unsigned int threadsCount = 0,
+                std::uint64_t seed = 0);
+
+        /**
+         * Plays the game until it is finished or \p MAX_GAME_PLIES is reached. A side without legal moves skips
+         * its turn, and the game ends when both sides have to skip a turn one after the other.
+         * @param board Board which is modified by the game
+         * @param side Side making the first move
+         * @param moveLog If provided, every move is recorded in it, the game has to be begun and ended by the caller
+         */
+        static GameResult playGame(Game::Board &board, Game::Side side, AI::Engine &red, AI::Engine &blue,
+                                   FileManagement::MoveLogWriter *moveLog = nullptr);
+
+        /**
+         * @return Openings made of \p plies random legal moves each
+         */
+        static std::vector<Opening> createRandomOpenings(unsigned int count, unsigned int plies, std::uint64_t seed);
+
+        /**
+         * Plays the \p gamesCount games, games are distributed between the threads
+         * @param moveLog If provided, all the games are written to it in the order of their indexes
+         */
+        TournamentResults run(unsigned int gamesCount, std::ostream *moveLog = nullptr) const;
+    };
+}
+
+#endif //PJC_HEXAGON_TOURNAMENT_H
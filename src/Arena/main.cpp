@@ -0,0 +1,147 @@
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "Tournament.h"
+
+namespace {
+    const std::string USAGE =
+            "Usage: hexagon_arena <engine> <engine> [--games N] [--threads N] [--opening-plies N] [--book FILE] "
+            "[--seed N] [--record FILE]\n"
+            "Engines: greedy, random, search:depth[:milliseconds], mcts:playouts[:milliseconds], "
+            "endgame:emptyFields:engine, book:file:engine\n"
+            "Book: one opening per line, moves written as fromRow,fromUiColumn-toRow,toUiColumn separated by spaces";
+
+    /**
+     * @return Openings read from the book, null option if the file cannot be read or contains an illegal move
+     */
+    std::optional<std::vector<Arena::Opening>> loadBook(const std::string &fileName) {
+        std::ifstream file(fileName);
+        if (!file.is_open()) return std::nullopt;
+
+        std::vector<Arena::Opening> openings;
+        std::string line;
+
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') continue;
+
+            Arena::Opening opening;
+            Game::Board board;
+            Game::Side side = Game::RedSide;
+            std::stringstream lineStream(line);
+            std::string moveText;
+
+            while (lineStream >> moveText) {
+                unsigned short fromRow, fromUiColumn, toRow, toUiColumn;
+                char comma1, dash, comma2;
+                std::stringstream moveStream(moveText);
+
+                if (!(moveStream >> fromRow >> comma1 >> fromUiColumn >> dash >> toRow >> comma2 >> toUiColumn) ||
+                    comma1 != ',' || dash != '-' || comma2 != ',')
+                    return std::nullopt;
+
+                Game::Move move(Game::MoveUnit(fromRow, fromUiColumn), Game::MoveUnit(toRow, toUiColumn));
+                if (!board.isMoveLegal(side, move)) return std::nullopt;
+
+                board.makeMove(side, move);
+                opening.emplace_back(move);
+                side = Game::Team::oppositeSide(side);
+            }
+
+            openings.emplace_back(opening);
+        }
+
+        return openings;
+    }
+
+    void printResults(
+            const Arena::EngineConfig &firstEngine,
+            const Arena::EngineConfig &secondEngine,
+            const Arena::TournamentResults &results) {
+        unsigned int gamesCount = results.getGamesCount();
+
+        std::cout << firstEngine.name << " vs " << secondEngine.name << ", " << gamesCount << " games" << std::endl;
+        std::cout << "wins " << results.wins << ", draws " << results.draws << ", losses " << results.losses
+                  << std::endl;
+        std::cout << std::fixed << std::setprecision(1) << "score " << results.getScore() * 100 << "%, Elo "
+                  << std::showpos << results.getEloDifference() << std::noshowpos << " +/- "
+                  << results.getEloErrorMargin() << std::endl;
+        std::cout << "average length " << static_cast<double>(results.plies) / std::max(gamesCount, 1u)
+                  << " plies" << std::endl;
+        std::cout << std::setprecision(2) << gamesCount / std::max(results.seconds, 1e-9) << " games/s"
+                  << std::endl;
+    }
+}
+
+/**
+ * Plays games between two engines without any UI, results are presented from the perspective of the first engine.
+ */
+int main(int argc, char *argv[]) {
+    std::vector<std::string> arguments(argv + 1, argv + argc);
+    if (arguments.size() < 2) {
+        std::cout << USAGE << std::endl;
+        return 2;
+    }
+
+    std::optional<Arena::EngineConfig> firstEngine = Arena::EngineConfig::parse(arguments[0]);
+    std::optional<Arena::EngineConfig> secondEngine = Arena::EngineConfig::parse(arguments[1]);
+    if (!firstEngine.has_value() || !secondEngine.has_value()) {
+        std::cout << USAGE << std::endl;
+        return 2;
+    }
+
+    unsigned int gamesCount = 100;
+    unsigned int threadsCount = 0;
+    unsigned int openingPlies = 4;
+    std::uint64_t seed = 0;
+    std::optional<std::string> bookFileName;
+    std::optional<std::string> moveLogFileName;
+
+    try {
+        for (size_t i = 2; i < arguments.size(); i += 2) {
+            if (i + 1 >= arguments.size()) throw std::invalid_argument(arguments[i]);
+
+            const std::string &value = arguments[i + 1];
+            if (arguments[i] == "--games") gamesCount = std::stoul(value);
+            else if (arguments[i] == "--threads") threadsCount = std::stoul(value);
+            else if (arguments[i] == "--opening-plies") openingPlies = std::stoul(value);
+            else if (arguments[i] == "--seed") seed = std::stoull(value);
+            else if (arguments[i] == "--book") bookFileName = value;
+            else if (arguments[i] == "--record") moveLogFileName = value;
+            else throw std::invalid_argument(arguments[i]);
+        }
+    } catch (const std::exception &) {
+        std::cout << USAGE << std::endl;
+        return 2;
+    }
+
+    std::vector<Arena::Opening> openings;
+
+    if (bookFileName.has_value()) {
+        std::optional<std::vector<Arena::Opening>> book = loadBook(bookFileName.value());
+        if (!book.has_value() || book->empty()) {
+            std::cout << "Failed to load the book " << bookFileName.value() << std::endl;
+            return 1;
+        }
+        openings = book.value();
+    } else if (openingPlies > 0)
+        // every opening is played twice, with the colours swapped
+        openings = Arena::Tournament::createRandomOpenings((gamesCount + 1) / 2, openingPlies, seed);
+
+    Arena::Tournament tournament(firstEngine.value(), secondEngine.value(), openings, threadsCount, seed);
+
+    std::ofstream moveLogFile;
+    if (moveLogFileName.has_value()) {
+        moveLogFile.open(moveLogFileName.value(), std::ios::binary | std::ios::trunc);
+        if (!moveLogFile.is_open()) {
+            std::cout << "Failed to open the move log " << moveLogFileName.value() << std::endl;
+            return 1;
+        }
+    }
+
+    Arena::TournamentResults results = tournament.run(gamesCount, moveLogFile.is_open() ? &moveLogFile : nullptr);
+
+    printResults(firstEngine.value(), secondEngine.value(), results);
+
+    return 0;
+}
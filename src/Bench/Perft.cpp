@@ -0,0 +1,34 @@
+#include "Perft.h"
+
+using namespace Bench;
+
+unsigned long long Perft::countNodes(
+        Game::Board &board,
+        Game::Side side,
+        short depth,
+        unsigned long long &mismatches) {
+    if (depth == 0 || board.isGameFinished()) return 1;
+
+    Game::Side enemySide = Game::Team::oppositeSide(side);
+    std::vector<Game::MoveWithBorderingStatus> moves = board.findLegalMoves(side, std::nullopt);
+
+    if (moves.empty()) return countNodes(board, enemySide, static_cast<short>(depth - 1), mismatches);
+
+    unsigned long long nodes = 0;
+    std::uint64_t hash = board.getHash();
+    Game::Points points = board.getPoints();
+
+    for (const Game::MoveWithBorderingStatus &move: moves) {
+        Game::UndoRecord undoRecord = board.makeMove(side, move);
+        nodes += countNodes(board, enemySide, static_cast<short>(depth - 1), mismatches);
+        board.unmakeMove(undoRecord);
+
+        Game::Points restoredPoints = board.getPoints();
+        if (board.getHash() != hash ||
+            restoredPoints.getTeamPoints(Game::RedSide) != points.getTeamPoints(Game::RedSide) ||
+            restoredPoints.getTeamPoints(Game::BlueSide) != points.getTeamPoints(Game::BlueSide))
+            mismatches++;
+    }
+
+    return nodes;
+}
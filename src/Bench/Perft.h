@@ -0,0 +1,27 @@
+#ifndef PJC_HEXAGON_PERFT_H
+#define PJC_HEXAGON_PERFT_H
+
+#include "../Game/Board.h"
+
+namespace Bench {
+    /**
+     * Counts the leaf nodes of the game tree, used for checking the correctness and the speed of move generation.
+     */
+    class Perft {
+    public:
+        /**
+         * Every legal move returned by \p Board::findLegalMoves is made with \p Board::makeMove and reverted with
+         * \p Board::unmakeMove. Finished games are counted as leaves, and a side without legal moves skips
+         * its turn, which counts as a single move.
+         * @param mismatches Incremented whenever a board is not restored correctly after unmaking a move
+         * @return Count of nodes at the \p depth
+         */
+        static unsigned long long countNodes(
+                Game::Board &board,
+                Game::Side side,
+                short depth,
+                unsigned long long &mismatches);
+    };
+}
+
+#endif //PJC_HEXAGON_PERFT_H
@@ -0,0 +1,524 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <set>
+#include "Perft.h"
+#include "../AI/ParallelSearchEngine.h"
+#include "../AI/RandomEngine.h"
+#include "../FileManagement/BinaryGameSerializer.h"
+#include "../FileManagement/FileManager.h"
+#include "../FileManagement/GameSerializer.h"
+#include "../Game/CaptureCounter.h"
+
+namespace {
+    std::atomic<unsigned long long> allocationsCount{0};
+
+    class BenchPosition {
+    public:
+        std::string name;
+        // game save in the GameSerializer format, empty for the initial position
+        std::string save;
+        // perft node counts for the depths starting from 1
+        std::vector<unsigned long long> expectedNodes;
+    };
+
+    const std::vector<BenchPosition> BENCH_POSITIONS = {
+            {"initial", "", {24, 570, 16830, 493848, 17031153}},
+            {"opening",
+             "0\n1\n1\n1\n0\n3,0,0\n2,4,0\n2,4,4\n3,9,3\n3,12,2\n3,13,1\n3,14,0\n3,15,0",
+             {16, 943, 21673, 1314230, 38267024}},
+            {"middle game",
+             "0\n1\n1\n1\n1\n2,0,0\n2,1,1\n2,2,1\n3,4,4\n2,5,2\n3,5,3\n3,7,3\n3,8,0\n2,8,1\n2,9,0\n3,13,1\n3,14,2",
+             {61, 3374, 213648, 12244293}},
+            {"crowded middle game",
+             "0\n1\n1\n1\n0\n3,0,0\n3,1,0\n3,1,1\n3,2,2\n2,3,1\n3,3,2\n3,3,3\n3,4,3\n3,4,4\n2,5,1\n2,6,1\n3,6,3\n"
+             "3,6,4\n2,7,1\n2,8,0\n2,9,0\n3,9,3\n3,10,4\n2,11,1\n2,12,1\n2,13,1\n2,14,1\n2,15,0\n2,15,1",
+             {105, 6635, 682132, 45651192}},
+    };
+
+    /**
+     * @return Board and side making a move in the \p position, null option if the save is corrupted
+     */
+    std::optional<std::pair<Game::Board, Game::Side>> loadPosition(const BenchPosition &position) {
+        if (position.save.empty()) return std::make_pair(Game::Board(), Game::RedSide);
+
+        std::optional<FileManagement::DeserializedGame> game =
+                FileManagement::GameSerializer::deserializeGame(position.save);
+        if (!game.has_value()) {
+            std::cout << position.name << ": failed to load the position" << std::endl;
+            return std::nullopt;
+        }
+
+        return std::make_pair(game->board, game->side);
+    }
+
+    /**
+     * Runs perft for every depth up to \p maxDepth and prints the results
+     * @return False if any node count differs from the expected one or the board was not restored correctly
+     */
+    bool benchPerft(const BenchPosition &position, short maxDepth) {
+        std::optional<std::pair<Game::Board, Game::Side>> loadedPosition = loadPosition(position);
+        if (!loadedPosition.has_value()) return false;
+
+        auto &[board, side] = loadedPosition.value();
+
+        std::cout << position.name << std::endl;
+        std::cout << std::setw(7) << "depth" << std::setw(14) << "nodes" << std::setw(12) << "time [ms]"
+                  << std::setw(14) << "nodes/s" << std::setw(14) << "allocs/node" << "  reference" << std::endl;
+
+        bool correct = true;
+
+        for (short depth = 1; depth <= maxDepth; depth++) {
+            unsigned long long mismatches = 0;
+            allocationsCount = 0;
+
+            auto start = std::chrono::steady_clock::now();
+            unsigned long long nodes = Bench::Perft::countNodes(board, side, depth, mismatches);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            unsigned long long allocations = allocationsCount;
+
+            std::string reference = "-";
+            if (static_cast<std::size_t>(depth) <= position.expectedNodes.size()) {
+                unsigned long long expected = position.expectedNodes[depth - 1];
+                if (expected == nodes) reference = "ok";
+                else {
+                    reference = "MISMATCH, expected " + std::to_string(expected);
+                    correct = false;
+                }
+            }
+            if (mismatches != 0) {
+                reference += ", board not restored " + std::to_string(mismatches) + " times";
+                correct = false;
+            }
+
+            std::cout << std::setw(7) << depth
+                      << std::setw(14) << nodes
+                      << std::setw(12) << std::fixed << std::setprecision(1) << elapsed.count() * 1000
+                      << std::setw(14) << std::setprecision(0) << nodes / std::max(elapsed.count(), 1e-9)
+                      << std::setw(14) << std::setprecision(2) << static_cast<double>(allocations) / nodes
+                      << "  " << reference << std::endl;
+        }
+
+        std::cout << std::endl;
+
+        return correct;
+    }
+
+    /**
+     * Compares the speed of \p findLegalMoves with \p generateMoves in the \p position
+     * @return False if the generated moves do not lead to the same positions as the legal moves
+     */
+    bool benchMoveGeneration(const BenchPosition &position, unsigned int iterations) {
+        std::optional<std::pair<Game::Board, Game::Side>> loadedPosition = loadPosition(position);
+        if (!loadedPosition.has_value()) return false;
+
+        auto &[board, side] = loadedPosition.value();
+
+        // clone moves to the same field lead to the same position, which is reached only once by the generator
+        std::set<std::uint64_t> legalPositions, generatedPositions;
+        for (const Game::MoveWithBorderingStatus &move: board.findLegalMoves(side, std::nullopt)) {
+            Game::Board child = board;
+            child.makeMove(side, move);
+            legalPositions.insert(child.getHash());
+        }
+
+        Game::MoveBuffer moves;
+        short movesCount = board.generateMoves(side, moves);
+        for (short i = 0; i < movesCount; i++) {
+            Game::Board child = board;
+            child.makeMoveUnchecked(side, moves[i].from, moves[i].to);
+            generatedPositions.insert(child.getHash());
+        }
+
+        bool correct = legalPositions == generatedPositions &&
+                       generatedPositions.size() == static_cast<std::size_t>(movesCount);
+
+        unsigned long long legalMovesCount = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; i++)
+            legalMovesCount += board.findLegalMoves(side, std::nullopt).size();
+        std::chrono::duration<double> legalElapsed = std::chrono::steady_clock::now() - start;
+
+        unsigned long long generatedMovesCount = 0;
+        start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; i++) generatedMovesCount += board.generateMoves(side, moves);
+        std::chrono::duration<double> generatedElapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::setw(22) << position.name
+                  << std::setw(14) << std::fixed << std::setprecision(0)
+                  << legalMovesCount / std::max(legalElapsed.count(), 1e-9)
+                  << std::setw(14) << generatedMovesCount / std::max(generatedElapsed.count(), 1e-9)
+                  << std::setw(10) << std::setprecision(1)
+                  << legalElapsed.count() / std::max(generatedElapsed.count(), 1e-9) << "x"
+                  << "  " << (correct ? "ok" : "MISMATCH") << std::endl;
+
+        return correct;
+    }
+
+    /**
+     * Greedy choice made straight out of \p Game::Board::findLegalMoves, as before the captures were counted for
+     * all the fields at once: the first move gaining the most points
+     */
+    std::optional<Game::Move> findReferenceGreedyMove(const Game::Board &board, Game::Side side) {
+        std::vector<Game::MoveWithBorderingStatus> legalMoves = board.findLegalMoves(side, std::nullopt);
+        if (legalMoves.empty()) return std::nullopt;
+
+        Game::Bitboard enemyCells = board.getSideCells(Game::Team::oppositeSide(side));
+        short bestMovePoints = 0;
+        Game::Move bestMove = legalMoves[0];
+
+        for (const Game::MoveWithBorderingStatus &move: legalMoves) {
+            Game::Bitboard capturedCells = Game::Bitboards::borderingCells(Game::Bitboards::cellIndex(move.to)) &
+                                           enemyCells;
+            auto points = static_cast<short>((move.isBordering ? 1 : 0) + 2 * Game::Bitboards::count(capturedCells));
+
+            if (points > bestMovePoints) {
+                bestMovePoints = points;
+                bestMove = move;
+            }
+        }
+
+        return bestMove;
+    }
+
+    bool isSameMove(const std::optional<Game::Move> &first, const std::optional<Game::Move> &second) {
+        if (!first.has_value() || !second.has_value()) return first.has_value() == second.has_value();
+
+        return first->from.row == second->from.row && first->from.uiColumn == second->from.uiColumn &&
+               first->to.row == second->to.row && first->to.uiColumn == second->to.uiColumn;
+    }
+
+    /**
+     * Compares \p Game::Board::findBestMove with the reference greedy choice in the position and in every position
+     * of a random game continued from it
+     * @return False if any of the picked moves differs
+     */
+    bool isGreedyChoiceCorrect(Game::Board board, Game::Side side, std::uint64_t seed) {
+        AI::RandomEngine engine(seed);
+
+        for (short ply = 0; ply < 400 && !board.isGameFinished(); ply++) {
+            if (!isSameMove(board.findBestMove(side), findReferenceGreedyMove(board, side))) return false;
+
+            std::optional<Game::Move> move = engine.findMove(board, side);
+            if (move.has_value()) {
+                board.makeMove(side, move.value());
+                board.fillBoardIfSideEliminated();
+            }
+            side = Game::Team::oppositeSide(side);
+        }
+
+        return true;
+    }
+
+    /**
+     * Measures the greedy player's move choice and every implementation of counting the captures in the \p position
+     * @return False if any implementation counts differently than the portable one, or the greedy player picks
+     * a different move than \p findReferenceGreedyMove
+     */
+    bool benchGreedy(const BenchPosition &position, unsigned int iterations) {
+        std::optional<std::pair<Game::Board, Game::Side>> loadedPosition = loadPosition(position);
+        if (!loadedPosition.has_value()) return false;
+
+        auto &[board, side] = loadedPosition.value();
+        Game::Bitboard enemyCells = board.getSideCells(Game::Team::oppositeSide(side));
+        auto implementations = Game::CaptureCounter::getSupportedImplementations();
+        bool correct = true;
+
+        for (std::uint64_t seed = 0; seed < 8; seed++) {
+            if (!isGreedyChoiceCorrect(board, side, seed)) correct = false;
+        }
+
+        Game::BorderingCounts expectedCounts;
+        implementations[0].second(enemyCells, expectedCounts);
+
+        std::cout << std::setw(22) << position.name;
+
+        for (const auto &[name, implementation]: implementations) {
+            Game::BorderingCounts counts{};
+            implementation(enemyCells, counts);
+            if (counts != expectedCounts) correct = false;
+
+            auto start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < iterations; i++) {
+                // the counted cells change every time, so the calls cannot be merged by the compiler
+                implementation(enemyCells ^ i, counts);
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            std::cout << std::setw(10) << name << std::setw(8) << std::fixed << std::setprecision(1)
+                      << elapsed.count() * 1e9 / iterations << " ns";
+        }
+
+        unsigned long long movesFound = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; i++) movesFound += board.findBestMove(side).has_value();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::setw(14) << "findBestMove" << std::setw(8) << elapsed.count() * 1e9 / iterations << " ns"
+                  << "  " << (correct && movesFound == iterations ? "ok" : "MISMATCH") << std::endl;
+
+        return correct && movesFound == iterations;
+    }
+
+    /**
+     * Searches the \p position to the \p depth with both parallel modes and every thread count up to
+     * \p maxThreads, and prints the speedup compared to a single thread
+     */
+    void benchSearch(const BenchPosition &position, short depth, unsigned int maxThreads) {
+        std::optional<std::pair<Game::Board, Game::Side>> loadedPosition = loadPosition(position);
+        if (!loadedPosition.has_value()) return;
+
+        auto &[board, side] = loadedPosition.value();
+
+        std::vector<unsigned int> threadCounts;
+        for (unsigned int threads = 1; threads < maxThreads; threads *= 2) threadCounts.emplace_back(threads);
+        threadCounts.emplace_back(maxThreads);
+
+        for (AI::ParallelMode mode: {AI::RootSplit, AI::LazySmp}) {
+            std::cout << position.name << (mode == AI::RootSplit ? ", root split" : ", lazy SMP") << std::endl;
+            std::cout << std::setw(9) << "threads" << std::setw(12) << "time [ms]" << std::setw(14) << "nodes"
+                      << std::setw(14) << "nodes/s" << std::setw(10) << "speedup" << std::setw(9) << "score"
+                      << std::setw(14) << "1st cutoff %" << std::endl;
+
+            double singleThreadTime = 0;
+
+            for (unsigned int threads: threadCounts) {
+                // every run gets a new table, so the results of the previous runs do not affect it
+                AI::ParallelSearchEngine engine(
+                        AI::SearchLimits(depth, std::chrono::milliseconds(0), 0),
+                        mode,
+                        threads);
+
+                auto start = std::chrono::steady_clock::now();
+                engine.findMove(board, side);
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+                if (threads == 1) singleThreadTime = elapsed.count();
+
+                const AI::SearchStatistics &statistics = engine.getStatistics();
+                std::cout << std::setw(9) << threads
+                          << std::setw(12) << std::fixed << std::setprecision(1) << elapsed.count() * 1000
+                          << std::setw(14) << statistics.nodes
+                          << std::setw(14) << std::setprecision(0)
+                          << statistics.nodes / std::max(elapsed.count(), 1e-9)
+                          << std::setw(10) << std::setprecision(2) << singleThreadTime / elapsed.count()
+                          << std::setw(9) << statistics.score
+                          << std::setw(14) << std::setprecision(1) << statistics.getFirstMoveCutoffRate() * 100
+                          << std::endl;
+            }
+
+            std::cout << std::endl;
+        }
+    }
+
+    /**
+     * Creates \p count positions by playing random moves, and compares loading them from the text saves with
+     * loading them from a single memory mapped binary archive
+     * @return False if any of the loaded positions differs from the saved one
+     */
+    bool benchSaves(unsigned int count) {
+        std::vector<FileManagement::DeserializedGame> games;
+        AI::RandomEngine engine(0);
+        Game::Board board;
+        Game::Side side = Game::RedSide;
+
+        while (games.size() < count) {
+            std::optional<Game::Move> move = engine.findMove(board, side);
+            if (move.has_value()) board.makeMove(side, move.value());
+            board.fillBoardIfSideEliminated();
+            side = Game::Team::oppositeSide(side);
+
+            if (board.isGameFinished()) {
+                board = Game::Board();
+                side = Game::RedSide;
+            }
+
+            games.emplace_back(
+                    Game::Teams(Game::Team(Game::RedSide, Game::Player), Game::Team(Game::BlueSide, Game::Computer)),
+                    side,
+                    board);
+        }
+
+        std::vector<std::string> textSaves;
+        std::size_t textSize = 0;
+        for (const FileManagement::DeserializedGame &game: games) {
+            textSaves.emplace_back(FileManagement::GameSerializer::serializeGame(game.teams, game.side, game.board));
+            textSize += textSaves.back().size();
+        }
+
+        std::string archiveName = "hexagon_bench_archive";
+        std::vector<unsigned char> archive = FileManagement::BinaryGameSerializer::serializeGames(games);
+        if (!FileManagement::FileManager::createBinarySaveFile(archiveName, archive)) {
+            std::cout << "Failed to write the archive" << std::endl;
+            return false;
+        }
+
+        bool correct = true;
+        auto isSameGame = [](const FileManagement::DeserializedGame &left,
+                             const FileManagement::DeserializedGame &right) {
+            return left.board.getHash() == right.board.getHash() && left.side == right.side &&
+                   left.teams.getBlue().getType() == right.teams.getBlue().getType();
+        };
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < count; i++) {
+            std::optional<FileManagement::DeserializedGame> game =
+                    FileManagement::GameSerializer::deserializeGame(textSaves[i]);
+            if (!game.has_value() || !isSameGame(game.value(), games[i])) correct = false;
+        }
+        std::chrono::duration<double> textElapsed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        std::optional<FileManagement::MappedFile> archiveFile =
+                FileManagement::FileManager::loadBinarySaveFile(archiveName);
+        std::optional<std::vector<FileManagement::DeserializedGame>> loadedGames;
+        if (archiveFile.has_value())
+            loadedGames = FileManagement::BinaryGameSerializer::deserializeGames(
+                    archiveFile->getData(),
+                    archiveFile->getSize());
+        std::chrono::duration<double> binaryElapsed = std::chrono::steady_clock::now() - start;
+
+        if (!loadedGames.has_value() || loadedGames->size() != count) correct = false;
+        else {
+            for (unsigned int i = 0; i < count; i++) {
+                if (!isSameGame(loadedGames.value()[i], games[i])) correct = false;
+            }
+        }
+
+        archiveFile.reset();
+        std::remove((archiveName + FileManagement::BINARY_SAVE_FILE_EXTENSION).c_str());
+
+        // database is opened again, so the time includes rebuilding the indexes out of the log
+        std::string databaseName = "hexagon_bench_database";
+        std::size_t databaseSize = 0;
+        std::vector<FileManagement::DatabaseEntry> entries;
+        for (unsigned int i = 0; i < count; i++) entries.emplace_back("position" + std::to_string(i), games[i]);
+
+        std::remove((databaseName + FileManagement::DATABASE_FILE_EXTENSION).c_str());
+        if (!FileManagement::FileManager::openDatabase(databaseName)->saveAll(entries)) correct = false;
+
+        start = std::chrono::steady_clock::now();
+        std::unique_ptr<FileManagement::PositionDatabase> database =
+                FileManagement::FileManager::openDatabase(databaseName);
+        if (!database || database->getSize() != count) correct = false;
+        else {
+            for (unsigned int i = 0; i < count; i++) {
+                std::optional<FileManagement::DeserializedGame> game = database->findByName(entries[i].name);
+                if (!game.has_value() || !isSameGame(game.value(), games[i])) correct = false;
+                if (database->findByPosition(games[i].board, games[i].side).empty()) correct = false;
+            }
+        }
+        std::chrono::duration<double> databaseElapsed = std::chrono::steady_clock::now() - start;
+
+        database.reset();
+        databaseSize = std::filesystem::file_size(databaseName + FileManagement::DATABASE_FILE_EXTENSION);
+        std::remove((databaseName + FileManagement::DATABASE_FILE_EXTENSION).c_str());
+
+        std::cout << count << " positions" << std::endl;
+        std::cout << std::setw(8) << "format" << std::setw(14) << "size [B]" << std::setw(12) << "time [ms]"
+                  << std::setw(16) << "positions/s" << std::endl;
+        std::cout << std::setw(8) << "text" << std::setw(14) << textSize << std::setw(12) << std::fixed
+                  << std::setprecision(1) << textElapsed.count() * 1000 << std::setw(16) << std::setprecision(0)
+                  << count / std::max(textElapsed.count(), 1e-9) << std::endl;
+        std::cout << std::setw(8) << "binary" << std::setw(14) << archive.size() << std::setw(12)
+                  << std::setprecision(1) << binaryElapsed.count() * 1000 << std::setw(16) << std::setprecision(0)
+                  << count / std::max(binaryElapsed.count(), 1e-9) << std::endl;
+        std::cout << std::setw(8) << "database" << std::setw(14) << databaseSize << std::setw(12)
+                  << std::setprecision(1) << databaseElapsed.count() * 1000 << std::setw(16) << std::setprecision(0)
+                  << count / std::max(databaseElapsed.count(), 1e-9) << std::endl;
+        std::cout << (correct ? "All positions loaded correctly" : "Some positions were loaded incorrectly")
+                  << std::endl;
+
+        return correct;
+    }
+}
+
+// every allocation is counted, so the allocations per node can be reported
+void *operator new(std::size_t size) {
+    allocationsCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void *pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+/**
+ * Usage:
+ * hexagon_bench [perft] [maxDepth] - runs perft, exits with a non-zero code if any of the results is incorrect
+ * hexagon_bench search [depth] [maxThreads] - measures the speedup of the parallel search
+ * hexagon_bench saves [count] - compares loading text saves with loading a binary archive and a database
+ * hexagon_bench movegen [iterations] - compares the moves per second of both move generators
+ * hexagon_bench greedy [iterations] - measures the greedy player and the implementations of counting captures, and
+ * checks that the greedy player picks the same moves as the choice made from findLegalMoves
+ */
+int main(int argc, char *argv[]) {
+    std::vector<std::string> arguments(argv + 1, argv + argc);
+    std::string mode = "perft";
+    if (!arguments.empty() && (arguments[0] == "perft" || arguments[0] == "search" || arguments[0] == "saves" ||
+                                arguments[0] == "movegen" || arguments[0] == "greedy")) {
+        mode = arguments[0];
+        arguments.erase(arguments.begin());
+    }
+
+    short depth = mode == "search" ? 6 : 4;
+    unsigned int maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    unsigned int savesCount = 100000;
+    unsigned int iterations = 1000000;
+
+    try {
+        if (mode == "saves" && !arguments.empty()) savesCount = std::stoul(arguments[0]);
+        else if ((mode == "movegen" || mode == "greedy") && !arguments.empty()) iterations = std::stoul(arguments[0]);
+        else if (!arguments.empty()) depth = static_cast<short>(std::stoi(arguments[0]));
+        if (arguments.size() > 1) maxThreads = std::stoi(arguments[1]);
+    } catch (const std::exception &) {
+        std::cout << "Usage: hexagon_bench [perft] [maxDepth] | hexagon_bench search [depth] [maxThreads] | "
+                     "hexagon_bench saves [count] | hexagon_bench movegen|greedy [iterations]" << std::endl;
+        return 2;
+    }
+
+    if (mode == "search") {
+        for (const BenchPosition &position: BENCH_POSITIONS) benchSearch(position, depth, maxThreads);
+        return 0;
+    }
+
+    if (mode == "saves") return benchSaves(savesCount) ? 0 : 1;
+
+    bool correct = true;
+
+    if (mode == "movegen") {
+        std::cout << std::setw(22) << "position" << std::setw(14) << "legal/s" << std::setw(14) << "generated/s"
+                  << std::setw(11) << "speedup" << std::endl;
+        for (const BenchPosition &position: BENCH_POSITIONS) {
+            if (!benchMoveGeneration(position, iterations)) correct = false;
+        }
+        return correct ? 0 : 1;
+    }
+
+    if (mode == "greedy") {
+        std::cout << "selected implementation: " << Game::CaptureCounter::getImplementationName() << std::endl;
+        for (const BenchPosition &position: BENCH_POSITIONS) {
+            if (!benchGreedy(position, iterations)) correct = false;
+        }
+        return correct ? 0 : 1;
+    }
+
+    for (const BenchPosition &position: BENCH_POSITIONS) {
+        if (!benchPerft(position, depth)) correct = false;
+    }
+
+    std::cout << (correct ? "All results are correct" : "Some results are incorrect") << std::endl;
+
+    return correct ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include "../AI/OpeningBookBuilder.h"
+#include "../FileManagement/MappedFile.h"
+
+namespace {
+    const std::string USAGE =
+            "Usage: hexagon_book search <book> <plies> <depth>[:milliseconds]\n"
+            "       hexagon_book games <book> <moveLog> <plies>\n"
+            "       hexagon_book show <book>\n"
+            "search - every position reachable within the plies gets the move found by the search\n"
+            "games - moves of the winners of the games recorded in the move log, e.g. by hexagon_arena --record\n"
+            "show - prints the size of the book and the moves saved for the initial position";
+
+    int showBook(const std::string &fileName) {
+        std::optional<FileManagement::OpeningBook> book = FileManagement::OpeningBook::open(fileName);
+        if (!book.has_value()) {
+            std::cout << "Failed to open the book " << fileName << std::endl;
+            return 1;
+        }
+
+        const Game::Board &board = Game::Board::getInitialPosition();
+        std::cout << book->getSize() << " entries" << std::endl;
+
+        for (const FileManagement::BookEntry &entry: book->findEntries(board, Game::RedSide)) {
+            std::cout << Game::Bitboards::cellRow(entry.from) << "," << Game::Bitboards::cellUiColumn(entry.from)
+                      << "-" << Game::Bitboards::cellRow(entry.to) << "," << Game::Bitboards::cellUiColumn(entry.to)
+                      << " weight " << entry.weight << std::endl;
+        }
+
+        return 0;
+    }
+}
+
+/**
+ * Builds the opening books used by \p AI::BookEngine
+ */
+int main(int argc, char *argv[]) {
+    std::vector<std::string> arguments(argv + 1, argv + argc);
+    if (arguments.size() == 2 && arguments[0] == "show") return showBook(arguments[1]);
+
+    if (arguments.size() != 4 || (arguments[0] != "search" && arguments[0] != "games")) {
+        std::cout << USAGE << std::endl;
+        return 2;
+    }
+
+    AI::OpeningBookBuilder builder;
+
+    try {
+        if (arguments[0] == "search") {
+            AI::SearchLimits limits;
+            std::size_t separator = arguments[3].find(':');
+            limits.depth = static_cast<short>(std::stoi(arguments[3].substr(0, separator)));
+            if (separator != std::string::npos)
+                limits.time = std::chrono::milliseconds(std::stoll(arguments[3].substr(separator + 1)));
+
+            std::size_t searchedCount = builder.addSearchedPositions(
+                    static_cast<short>(std::stoi(arguments[2])), limits,
+                    [](std::size_t count) { std::cout << "\rsearched " << count << " positions" << std::flush; });
+            std::cout << "\rsearched " << searchedCount << " positions" << std::endl;
+        } else {
+            std::optional<FileManagement::MappedFile> moveLog = FileManagement::MappedFile::open(arguments[2]);
+            std::optional<std::vector<FileManagement::GameReplay>> games;
+            if (moveLog.has_value())
+                games = FileManagement::GameReplay::readAll(moveLog->getData(), moveLog->getSize());
+            if (!games.has_value()) {
+                std::cout << "Failed to read the move log " << arguments[2] << std::endl;
+                return 1;
+            }
+
+            std::size_t addedCount = builder.addGames(games.value(), std::stoul(arguments[3]));
+            std::cout << "added " << addedCount << " moves from " << games->size() << " games" << std::endl;
+        }
+    } catch (const std::exception &) {
+        std::cout << USAGE << std::endl;
+        return 2;
+    }
+
+    if (!builder.write(arguments[1])) {
+        std::cout << "Failed to write the book " << arguments[1] << std::endl;
+        return 1;
+    }
+
+    return showBook(arguments[1]);
+}
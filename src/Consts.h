@@ -3,5 +3,7 @@
 
 const short BOARD_ROWS_COUNT = 17;
 const short BOARD_COLUMNS_COUNT = 9;
+// count of all the fields on the board, 58 playable ones and 3 blocked
+const short BOARD_CELLS_COUNT = 61;
 
 #endif //PJC_HEXAGON_CONSTS_H
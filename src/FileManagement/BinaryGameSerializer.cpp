@@ -0,0 +1,143 @@
+#include "BinaryGameSerializer.h"
+#include <algorithm>
+#include <iterator>
+
+using namespace FileManagement;
+
+// header scheme: magic (4 bytes), version (2), record size (2), count of games (4), checksum (4)
+void BinaryGameSerializer::writeHeader(unsigned char *header, std::uint32_t gamesCount) {
+    std::copy(std::begin(BINARY_SAVE_MAGIC), std::end(BINARY_SAVE_MAGIC), header);
+    writeNumber(header + 4, BINARY_SAVE_VERSION, 2);
+    writeNumber(header + 6, BINARY_SAVE_RECORD_SIZE, 2);
+    writeNumber(header + 8, gamesCount, 4);
+    writeNumber(header + 12, checksum(header, 12), 4);
+}
+
+// record scheme: red team type (1 byte), blue team type (1), side (1), padding (1), red fields bitboard (8),
+// blue fields bitboard (8), blocked fields bitboard (8), checksum (4)
+void BinaryGameSerializer::writeRecord(
+        unsigned char *record,
+        const Game::Teams &teams,
+        Game::Side side,
+        const Game::Board &board) {
+    writeNumber(record, teams.getRed().getType(), 1);
+    writeNumber(record + 1, teams.getBlue().getType(), 1);
+    writeNumber(record + 2, side, 1);
+    writeNumber(record + 3, 0, 1);
+    writeNumber(record + 4, board.getSideCells(Game::RedSide), 8);
+    writeNumber(record + 12, board.getSideCells(Game::BlueSide), 8);
+    writeNumber(record + 20, board.getBlockedCells(), 8);
+    writeNumber(record + 28, checksum(record, 28), 4);
+}
+
+std::optional<DeserializedGame> BinaryGameSerializer::readRecord(const unsigned char *record) {
+    if (readNumber(record + 28, 4) != checksum(record, 28)) return std::nullopt;
+
+    std::uint64_t redType = readNumber(record, 1);
+    std::uint64_t blueType = readNumber(record + 1, 1);
+    std::uint64_t side = readNumber(record + 2, 1);
+    if (redType > Game::MctsComputer || blueType > Game::MctsComputer || side > Game::BlueSide) return std::nullopt;
+
+    try {
+        Game::Board board = Game::Board::fromBitboards(readNumber(record + 4, 8), readNumber(record + 12, 8));
+        if (board.getBlockedCells() != readNumber(record + 20, 8)) return std::nullopt;
+
+        return DeserializedGame(
+                Game::Teams(Game::Team(Game::RedSide, static_cast<Game::TeamType>(redType)),
+                            Game::Team(Game::BlueSide, static_cast<Game::TeamType>(blueType))),
+                static_cast<Game::Side>(side),
+                board);
+    } catch (const std::exception &) {
+        return std::nullopt;
+    }
+}
+
+std::uint32_t BinaryGameSerializer::checksum(const unsigned char *data, std::size_t size) {
+    std::uint32_t hash = 2166136261u;
+
+    for (std::size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+void BinaryGameSerializer::writeNumber(unsigned char *destination, std::uint64_t number, std::size_t bytesCount) {
+    for (std::size_t i = 0; i < bytesCount; i++) destination[i] = static_cast<unsigned char>(number >> (8 * i));
+}
+
+std::uint64_t BinaryGameSerializer::readNumber(const unsigned char *source, std::size_t bytesCount) {
+    std::uint64_t number = 0;
+
+    for (std::size_t i = 0; i < bytesCount; i++) number |= static_cast<std::uint64_t>(source[i]) << (8 * i);
+
+    return number;
+}
+
+std::vector<unsigned char> BinaryGameSerializer::serializeGame(
+        const Game::Teams &teams,
+        const Game::Side &side,
+        const Game::Board &board) {
+    std::vector<unsigned char> data(BINARY_SAVE_HEADER_SIZE + BINARY_SAVE_RECORD_SIZE);
+    writeHeader(data.data(), 1);
+    writeRecord(data.data() + BINARY_SAVE_HEADER_SIZE, teams, side, board);
+
+    return data;
+}
+
+std::vector<unsigned char> BinaryGameSerializer::serializeGames(const std::vector<DeserializedGame> &games) {
+    std::vector<unsigned char> data(BINARY_SAVE_HEADER_SIZE + BINARY_SAVE_RECORD_SIZE * games.size());
+    writeHeader(data.data(), static_cast<std::uint32_t>(games.size()));
+
+    for (std::size_t i = 0; i < games.size(); i++) {
+        writeRecord(data.data() + BINARY_SAVE_HEADER_SIZE + BINARY_SAVE_RECORD_SIZE * i,
+                    games[i].teams, games[i].side, games[i].board);
+    }
+
+    return data;
+}
+
+std::optional<std::uint32_t> BinaryGameSerializer::readGamesCount(const unsigned char *data, std::size_t size) {
+    if (data == nullptr || size < BINARY_SAVE_HEADER_SIZE) return std::nullopt;
+    if (!std::equal(std::begin(BINARY_SAVE_MAGIC), std::end(BINARY_SAVE_MAGIC), data)) return std::nullopt;
+    if (readNumber(data + 12, 4) != checksum(data, 12)) return std::nullopt;
+    if (readNumber(data + 4, 2) != BINARY_SAVE_VERSION || readNumber(data + 6, 2) != BINARY_SAVE_RECORD_SIZE)
+        return std::nullopt;
+
+    auto gamesCount = static_cast<std::uint32_t>(readNumber(data + 8, 4));
+    if (size != BINARY_SAVE_HEADER_SIZE + BINARY_SAVE_RECORD_SIZE * static_cast<std::size_t>(gamesCount))
+        return std::nullopt;
+
+    return gamesCount;
+}
+
+std::optional<DeserializedGame> BinaryGameSerializer::deserializeGame(
+        const unsigned char *data,
+        std::size_t size,
+        std::uint32_t index) {
+    std::optional<std::uint32_t> gamesCount = readGamesCount(data, size);
+    if (!gamesCount.has_value() || index >= gamesCount.value()) return std::nullopt;
+
+    return readRecord(data + BINARY_SAVE_HEADER_SIZE + BINARY_SAVE_RECORD_SIZE * static_cast<std::size_t>(index));
+}
+
+std::optional<std::vector<DeserializedGame>> BinaryGameSerializer::deserializeGames(
+        const unsigned char *data,
+        std::size_t size) {
+    std::optional<std::uint32_t> gamesCount = readGamesCount(data, size);
+    if (!gamesCount.has_value()) return std::nullopt;
+
+    std::vector<DeserializedGame> games;
+    games.reserve(gamesCount.value());
+
+    for (std::uint32_t i = 0; i < gamesCount.value(); i++) {
+        std::optional<DeserializedGame> game =
+                readRecord(data + BINARY_SAVE_HEADER_SIZE + BINARY_SAVE_RECORD_SIZE * static_cast<std::size_t>(i));
+        if (!game.has_value()) return std::nullopt;
+
+        games.emplace_back(game.value());
+    }
+
+    return games;
+}
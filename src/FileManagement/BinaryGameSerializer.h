@@ -0,0 +1,70 @@
+#ifndef PJC_HEXAGON_BINARYGAMESERIALIZER_H
+#define PJC_HEXAGON_BINARYGAMESERIALIZER_H
+
+#include <cstdint>
+#include "GameSerializer.h"
+
+namespace FileManagement {
+    // first bytes of every binary save
+    const unsigned char BINARY_SAVE_MAGIC[4] = {'H', 'X', 'G', 'N'};
+    // has to be increased with every change of the layout of the header or the records
+    const std::uint16_t BINARY_SAVE_VERSION = 1;
+    // magic, version, record size, count of records and a checksum of the header
+    const std::size_t BINARY_SAVE_HEADER_SIZE = 16;
+    // team types, side, padding byte, three bitboards and a checksum of the record
+    const std::size_t BINARY_SAVE_RECORD_SIZE = 32;
+
+    /**
+     * Fixed-size binary format, a header followed by any count of games, so a single file can hold a whole
+     * archive of positions. All the numbers are little endian, and both the header and every record have
+     * their own checksum.
+     * Deserialize methods return a null option if the data is invalid, in the same way as in \p GameSerializer.
+     */
+    class BinaryGameSerializer {
+    private:
+        static void writeHeader(unsigned char *header, std::uint32_t gamesCount);
+
+    public:
+        /**
+         * Writes a single game, \p record has to have at least \p BINARY_SAVE_RECORD_SIZE bytes
+         */
+        static void writeRecord(unsigned char *record, const Game::Teams &teams, Game::Side side,
+                                const Game::Board &board);
+
+        /**
+         * Reads a single game written by \p writeRecord, also used by the other formats built of the records
+         */
+        static std::optional<DeserializedGame> readRecord(const unsigned char *record);
+
+        /**
+         * FNV-1a hash of the \p data
+         */
+        static std::uint32_t checksum(const unsigned char *data, std::size_t size);
+
+        static void writeNumber(unsigned char *destination, std::uint64_t number, std::size_t bytesCount);
+
+        static std::uint64_t readNumber(const unsigned char *source, std::size_t bytesCount);
+
+        static std::vector<unsigned char> serializeGame(const Game::Teams &teams, const Game::Side &side,
+                                                        const Game::Board &board);
+
+        static std::vector<unsigned char> serializeGames(const std::vector<DeserializedGame> &games);
+
+        /**
+         * Validates the header and the size of the data, records are validated only when they are read
+         * @return Count of the games in the \p data
+         */
+        static std::optional<std::uint32_t> readGamesCount(const unsigned char *data, std::size_t size);
+
+        /**
+         * @param index Index of the game in the archive, reading a single game does not touch the other ones
+         */
+        static std::optional<DeserializedGame> deserializeGame(const unsigned char *data, std::size_t size,
+                                                               std::uint32_t index = 0);
+
+        static std::optional<std::vector<DeserializedGame>> deserializeGames(const unsigned char *data,
+                                                                             std::size_t size);
+    };
+}
+
+#endif //PJC_HEXAGON_BINARYGAMESERIALIZER_H
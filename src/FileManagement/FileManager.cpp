@@ -10,6 +10,30 @@ std::optional<std::string> FileManager::loadSaveFile(const std::string &fileName
     return loadFile(fileName + SAVE_FILE_EXTENSION);
 }
 
+bool FileManager::createBinarySaveFile(const std::string &fileName, const std::vector<unsigned char> &saveData) {
+    try {
+        std::ofstream stream(fileName + BINARY_SAVE_FILE_EXTENSION, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char *>(saveData.data()), static_cast<std::streamsize>(saveData.size()));
+        stream.close();
+
+        return !stream.fail();
+    } catch (const std::exception &) {
+        return false;
+    }
+}
+
+std::optional<MappedFile> FileManager::loadBinarySaveFile(const std::string &fileName) {
+    try {
+        return MappedFile::open(fileName + BINARY_SAVE_FILE_EXTENSION);
+    } catch (const std::exception &) {
+        return std::nullopt;
+    }
+}
+
+std::unique_ptr<PositionDatabase> FileManager::openDatabase(const std::string &fileName) {
+    return PositionDatabase::open(fileName + DATABASE_FILE_EXTENSION);
+}
+
 bool FileManager::updateRankingFile(const std::string &ranking) {
     return overwriteFile(RANKING_FILE_NAME, ranking);
 }
@@ -4,9 +4,14 @@
 #include <string>
 #include <fstream>
 #include <optional>
+#include <vector>
+#include "MappedFile.h"
+#include "PositionDatabase.h"
 
 namespace FileManagement {
     const std::string SAVE_FILE_EXTENSION = ".save";
+    const std::string BINARY_SAVE_FILE_EXTENSION = ".hxsave";
+    const std::string DATABASE_FILE_EXTENSION = ".hxdb";
     const std::string RANKING_FILE_NAME = "ranking.txt";
 
     /**
@@ -24,6 +29,19 @@ namespace FileManagement {
 
         static std::optional<std::string> loadSaveFile(const std::string &fileName);
 
+        static bool createBinarySaveFile(const std::string &fileName, const std::vector<unsigned char> &saveData);
+
+        /**
+         * @return Memory mapped save, which can be read with \p BinaryGameSerializer
+         */
+        static std::optional<MappedFile> loadBinarySaveFile(const std::string &fileName);
+
+        /**
+         * Opens a database in which many games can be saved, alternative to the separate save files
+         * @return Null pointer if the database cannot be opened
+         */
+        static std::unique_ptr<PositionDatabase> openDatabase(const std::string &fileName);
+
         static bool updateRankingFile(const std::string &ranking);
 
         static std::optional<std::string> loadRankingFile();
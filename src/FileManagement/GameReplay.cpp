@@ -0,0 +1,185 @@
+#include "GameReplay.h"
+#include "BinaryGameSerializer.h"
+
+using namespace FileManagement;
+
+GameReplay::GameReplay(Game::Teams teams, Game::Side startingSide, std::uint16_t keyframeInterval, Game::Board board)
+        : teams(teams), startingSide(startingSide), keyframeInterval(keyframeInterval), board(board),
+          side(startingSide) {
+    this->keyframes.emplace_back(board);
+}
+
+void GameReplay::applyMove(Game::Board &board, Game::Side side, std::pair<short, short> move) {
+    if (move.first == Game::NO_CELL) return;
+
+    board.makeMoveUnchecked(side, move.first, move.second);
+    board.fillBoardIfSideEliminated();
+}
+
+std::optional<GameReplay> GameReplay::read(const unsigned char *data, std::size_t size, std::size_t &offset) {
+    if (offset + MOVE_LOG_HEADER_SIZE > size) return std::nullopt;
+
+    const unsigned char *header = data + offset;
+    if (!std::equal(std::begin(MOVE_LOG_MAGIC), std::end(MOVE_LOG_MAGIC), header) ||
+        BinaryGameSerializer::readNumber(header + 4, 2) != MOVE_LOG_VERSION)
+        return std::nullopt;
+
+    auto keyframeInterval = static_cast<std::uint16_t>(BinaryGameSerializer::readNumber(header + 6, 2));
+    std::uint64_t redType = BinaryGameSerializer::readNumber(header + 8, 1);
+    std::uint64_t blueType = BinaryGameSerializer::readNumber(header + 9, 1);
+    std::uint64_t startingSide = BinaryGameSerializer::readNumber(header + 10, 1);
+    if (keyframeInterval == 0 || redType > Game::MctsComputer || blueType > Game::MctsComputer ||
+        startingSide > Game::BlueSide)
+        return std::nullopt;
+
+    std::optional<GameReplay> replay;
+    try {
+        replay = GameReplay(
+                Game::Teams(Game::Team(Game::RedSide, static_cast<Game::TeamType>(redType)),
+                            Game::Team(Game::BlueSide, static_cast<Game::TeamType>(blueType))),
+                static_cast<Game::Side>(startingSide),
+                keyframeInterval,
+                Game::Board::fromBitboards(
+                        BinaryGameSerializer::readNumber(header + 12, 8),
+                        BinaryGameSerializer::readNumber(header + 20, 8)));
+    } catch (const std::exception &) {
+        return std::nullopt;
+    }
+
+    std::size_t position = offset + MOVE_LOG_HEADER_SIZE;
+    // the game gets replayed while reading, so the moves and the keyframes can be validated
+    Game::Board board = replay->board;
+    Game::Side side = replay->startingSide;
+
+    while (position + 2 <= size) {
+        // header of the next game, written after a game that was never ended, e.g. because the program was killed
+        if (position + sizeof(MOVE_LOG_MAGIC) <= size &&
+            std::equal(std::begin(MOVE_LOG_MAGIC), std::end(MOVE_LOG_MAGIC), data + position))
+            break;
+
+        std::uint64_t token = BinaryGameSerializer::readNumber(data + position, 2);
+        auto type = static_cast<MoveLogToken>(token >> 12);
+        auto from = static_cast<short>(token & 0x3F);
+        auto to = static_cast<short>(token >> 6 & 0x3F);
+        position += 2;
+
+        if (type == EndToken) {
+            replay->finished = true;
+            break;
+        }
+
+        if (type == AbandonToken) break;
+
+        if (type == KeyframeToken) {
+            if (position + MOVE_LOG_KEYFRAME_SIZE > size || replay->moves.empty() ||
+                replay->moves.size() % keyframeInterval != 0 ||
+                replay->keyframes.size() != replay->moves.size() / keyframeInterval)
+                return std::nullopt;
+
+            if (board.getSideCells(Game::RedSide) != BinaryGameSerializer::readNumber(data + position, 8) ||
+                board.getSideCells(Game::BlueSide) != BinaryGameSerializer::readNumber(data + position + 8, 8))
+                return std::nullopt;
+
+            replay->keyframes.emplace_back(board);
+            position += MOVE_LOG_KEYFRAME_SIZE;
+            continue;
+        }
+
+        std::pair<short, short> move = {Game::NO_CELL, Game::NO_CELL};
+        if (type == MoveToken) {
+            if (from >= BOARD_CELLS_COUNT || to >= BOARD_CELLS_COUNT) return std::nullopt;
+
+            Game::Move boardMove(
+                    Game::MoveUnit(Game::Bitboards::cellRow(from), Game::Bitboards::cellUiColumn(from)),
+                    Game::MoveUnit(Game::Bitboards::cellRow(to), Game::Bitboards::cellUiColumn(to)));
+            if (!board.isMoveLegal(side, boardMove)) return std::nullopt;
+
+            move = {from, to};
+        } else if (type != PassToken) return std::nullopt;
+
+        applyMove(board, side, move);
+        replay->moves.emplace_back(move);
+        side = Game::Team::oppositeSide(side);
+    }
+
+    // trailing byte of a game cut off in the middle of a token is skipped
+    offset = position + 2 > size ? size : position;
+
+    return replay;
+}
+
+std::optional<std::vector<GameReplay>> GameReplay::readAll(const unsigned char *data, std::size_t size) {
+    std::vector<GameReplay> replays;
+    std::size_t offset = 0;
+
+    while (offset < size) {
+        std::optional<GameReplay> replay = read(data, size, offset);
+        if (!replay.has_value()) return std::nullopt;
+
+        replays.emplace_back(replay.value());
+    }
+
+    return replays;
+}
+
+bool GameReplay::seek(unsigned int _ply) {
+    if (_ply > this->moves.size()) return false;
+
+    // moving forward from the current board is never longer than starting from the keyframe
+    if (_ply < this->ply || _ply - this->ply > _ply % this->keyframeInterval) {
+        unsigned int keyframe = std::min<unsigned int>(_ply / this->keyframeInterval, this->keyframes.size() - 1);
+
+        this->board = this->keyframes[keyframe];
+        this->ply = keyframe * this->keyframeInterval;
+        this->side = this->ply % 2 == 0 ? this->startingSide : Game::Team::oppositeSide(this->startingSide);
+    }
+
+    for (; this->ply < _ply; this->ply++) {
+        applyMove(this->board, this->side, this->moves[this->ply]);
+        this->side = Game::Team::oppositeSide(this->side);
+    }
+
+    return true;
+}
+
+bool GameReplay::next() {
+    return seek(this->ply + 1);
+}
+
+bool GameReplay::previous() {
+    return this->ply != 0 && seek(this->ply - 1);
+}
+
+const Game::Board &GameReplay::getBoard() const {
+    return this->board;
+}
+
+Game::Side GameReplay::getSide() const {
+    return this->side;
+}
+
+unsigned int GameReplay::getPly() const {
+    return this->ply;
+}
+
+unsigned int GameReplay::getPliesCount() const {
+    return this->moves.size();
+}
+
+std::optional<Game::Move> GameReplay::getMove(unsigned int _ply) const {
+    if (_ply == 0 || _ply > this->moves.size() || this->moves[_ply - 1].first == Game::NO_CELL) return std::nullopt;
+
+    const std::pair<short, short> &move = this->moves[_ply - 1];
+
+    return Game::Move(
+            Game::MoveUnit(Game::Bitboards::cellRow(move.first), Game::Bitboards::cellUiColumn(move.first)),
+            Game::MoveUnit(Game::Bitboards::cellRow(move.second), Game::Bitboards::cellUiColumn(move.second)));
+}
+
+const Game::Teams &GameReplay::getTeams() const {
+    return this->teams;
+}
+
+bool GameReplay::isFinished() const {
+    return this->finished;
+}
@@ -0,0 +1,79 @@
+#ifndef PJC_HEXAGON_GAMEREPLAY_H
+#define PJC_HEXAGON_GAMEREPLAY_H
+
+#include "MoveLog.h"
+
+namespace FileManagement {
+    /**
+     * Single game read from a move log, allows moving to any ply of the game. Moving to a ply starts from
+     * the nearest keyframe before it, so it takes at most \p keyframeInterval moves.
+     */
+    class GameReplay {
+    private:
+        Game::Teams teams;
+        Game::Side startingSide;
+        std::uint16_t keyframeInterval;
+        // moves of all the plies, skipped turns are saved as moves from and to NO_CELL
+        std::vector<std::pair<short, short>> moves;
+        // boards after every "keyframeInterval" plies, the first one is the starting board
+        std::vector<Game::Board> keyframes;
+        // false if the game was abandoned, or its end was never recorded, e.g. because the program was closed
+        bool finished = false;
+
+        Game::Board board;
+        Game::Side side;
+        unsigned int ply = 0;
+
+        GameReplay(Game::Teams teams, Game::Side startingSide, std::uint16_t keyframeInterval, Game::Board board);
+
+        static void applyMove(Game::Board &board, Game::Side side, std::pair<short, short> move);
+
+    public:
+        /**
+         * Reads the game starting at the \p offset, every move is checked and the keyframes are compared
+         * with the replayed boards
+         * Game which was never ended stops at the header of the next game, or at the end of the data
+         * @param offset Moved to the end of the game
+         * @return Null option if the data is not a valid game
+         */
+        static std::optional<GameReplay> read(const unsigned char *data, std::size_t size, std::size_t &offset);
+
+        /**
+         * @return All the games written to the log one after another
+         */
+        static std::optional<std::vector<GameReplay>> readAll(const unsigned char *data, std::size_t size);
+
+        /**
+         * Moves the replay to the board after the \p ply, the ply 0 is the starting board
+         * @return False if the game has fewer plies
+         */
+        bool seek(unsigned int _ply);
+
+        bool next();
+
+        bool previous();
+
+        const Game::Board &getBoard() const;
+
+        /**
+         * @return Side making a move after the current ply
+         */
+        Game::Side getSide() const;
+
+        unsigned int getPly() const;
+
+        unsigned int getPliesCount() const;
+
+        /**
+         * @param _ply Plies are counted from 1, the move of the ply leads to the board at that ply
+         * @return Move of the ply, null option if the turn was skipped or there is no such ply
+         */
+        std::optional<Game::Move> getMove(unsigned int _ply) const;
+
+        const Game::Teams &getTeams() const;
+
+        bool isFinished() const;
+    };
+}
+
+#endif //PJC_HEXAGON_GAMEREPLAY_H
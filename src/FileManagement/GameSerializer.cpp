@@ -2,7 +2,7 @@
 
 using namespace FileManagement;
 
-DeserializedGame::DeserializedGame(Game::Teams *teams, Game::Side side, Game::Board *board) {
+DeserializedGame::DeserializedGame(Game::Teams teams, Game::Side side, Game::Board board) {
     this->teams = teams;
     this->side = side;
     this->board = board;
@@ -18,10 +18,10 @@ std::string GameSerializer::serializeGame(
 }
 
 std::string GameSerializer::serializeTeams(const Game::Teams &teams) {
-    return std::to_string(teams.getRed()->getSide()) + '\n'
-           + std::to_string(teams.getRed()->getType()) + '\n'
-           + std::to_string(teams.getBlue()->getSide()) + '\n'
-           + std::to_string(teams.getBlue()->getType());
+    return std::to_string(teams.getRed().getSide()) + '\n'
+           + std::to_string(teams.getRed().getType()) + '\n'
+           + std::to_string(teams.getBlue().getSide()) + '\n'
+           + std::to_string(teams.getBlue().getType());
 }
 
 std::string GameSerializer::serializeSide(const Game::Side &side) {
@@ -32,22 +32,20 @@ std::string GameSerializer::serializeSide(const Game::Side &side) {
 std::string GameSerializer::serializeBoard(const Game::Board &board) {
     std::string serializedBoard;
 
-    auto boardFields = board.getFields();
-    std::for_each(boardFields.begin(), boardFields.end(),
-                  [&serializedBoard](const std::vector<Game::Field *> &fields) {
-                      std::for_each(fields.begin(), fields.end(), [&serializedBoard](Game::Field *field) {
-                          // no need to save empty and blocked fields as these will be autofilled
-                          if (field->getState() == Game::FieldState::Red ||
-                              field->getState() == Game::FieldState::Blue) {
-                              // newline is added before every line except first
-                              if (!serializedBoard.empty()) serializedBoard += '\n';
-                              serializedBoard +=
-                                      std::to_string(field->getState()) + ','
-                                      + std::to_string(field->getRow()) + ','
-                                      + std::to_string(field->getColumn());
-                          }
-                      });
-                  });
+    for (short row = 0; row < BOARD_ROWS_COUNT; row++) {
+        for (const Game::Field &field: board.getRow(row)) {
+            // no need to save empty and blocked fields as these will be autofilled
+            if (field.getState() != Game::FieldState::Red && field.getState() != Game::FieldState::Blue) continue;
+
+            // newline is added before every line except first
+            if (!serializedBoard.empty()) serializedBoard += '\n';
+            serializedBoard += std::to_string(field.getState());
+            serializedBoard += ',';
+            serializedBoard += std::to_string(field.getRow());
+            serializedBoard += ',';
+            serializedBoard += std::to_string(field.getColumn());
+        }
+    }
 
     return serializedBoard;
 }
@@ -55,22 +53,34 @@ std::string GameSerializer::serializeBoard(const Game::Board &board) {
 std::optional<DeserializedGame> GameSerializer::deserializeGame(const std::string &game) {
     std::vector<std::string> lines = splitString(game, '\n');
 
-    std::optional<Game::Teams *> teams = deserializeTeams({lines.begin(), lines.begin() + 4});
+    std::optional<Game::Teams> teams = deserializeTeams({lines.begin(), lines.begin() + 4});
     std::optional<Game::Side> side = deserializeSide(lines[4]);
-    std::optional<Game::Board *> board = deserializeBoard({lines.begin() + 5, lines.end()});
+    std::optional<Game::Board> board = deserializeBoard({lines.begin() + 5, lines.end()});
 
     if (!teams.has_value() || !side.has_value() || !board.has_value()) return std::nullopt;
 
     return DeserializedGame(teams.value(), side.value(), board.value());
 }
 
-std::optional<Game::Teams *> GameSerializer::deserializeTeams(std::vector<std::string> teamsLines) {
+bool GameSerializer::isSideValid(int side) {
+    return side == Game::RedSide || side == Game::BlueSide;
+}
+
+std::optional<Game::Teams> GameSerializer::deserializeTeams(std::vector<std::string> teamsLines) {
     try {
-        return new Game::Teams(
-                new Game::Team(static_cast<Game::Side>(stoi(teamsLines[0])),
-                               static_cast<Game::TeamType>(stoi(teamsLines[1]))),
-                new Game::Team(static_cast<Game::Side>(stoi(teamsLines[2])),
-                               static_cast<Game::TeamType>(stoi(teamsLines[3]))));
+        int firstSide = stoi(teamsLines[0]);
+        int firstType = stoi(teamsLines[1]);
+        int secondSide = stoi(teamsLines[2]);
+        int secondType = stoi(teamsLines[3]);
+
+        // values are used as indexes, so anything outside of the enums is rejected, as in the binary saves
+        if (!isSideValid(firstSide) || !isSideValid(secondSide) || firstType < Game::Player ||
+            firstType > Game::MctsComputer || secondType < Game::Player || secondType > Game::MctsComputer)
+            return std::nullopt;
+
+        return Game::Teams(
+                Game::Team(static_cast<Game::Side>(firstSide), static_cast<Game::TeamType>(firstType)),
+                Game::Team(static_cast<Game::Side>(secondSide), static_cast<Game::TeamType>(secondType)));
     } catch (const std::exception &) {
         return std::nullopt;
     }
@@ -78,28 +88,36 @@ std::optional<Game::Teams *> GameSerializer::deserializeTeams(std::vector<std::s
 
 std::optional<Game::Side> GameSerializer::deserializeSide(const std::string &side) {
     try {
-        return static_cast<Game::Side>(std::stoi(side));
+        int value = std::stoi(side);
+        if (!isSideValid(value)) return std::nullopt;
+
+        return static_cast<Game::Side>(value);
     } catch (const std::exception &) {
         return std::nullopt;
     }
 }
 
-std::optional<Game::Board *> GameSerializer::deserializeBoard(std::vector<std::string> boardLines) {
+std::optional<Game::Board> GameSerializer::deserializeBoard(std::vector<std::string> boardLines) {
     try {
-        std::vector<Game::Field *> fields;
+        std::vector<Game::Field> fields;
 
         std::for_each(boardLines.begin(), boardLines.end(), [&fields](const std::string &line) {
             std::vector<std::string> lineParts = splitString(line, ',');
-            auto state = static_cast<Game::FieldState>(std::stoi(lineParts[0]));
+            int stateValue = std::stoi(lineParts[0]);
+            if (stateValue < Game::Empty || stateValue > Game::Blue)
+                throw std::invalid_argument("Field state is invalid");
+
+            auto state = static_cast<Game::FieldState>(stateValue);
             short row = std::stoi(lineParts[1]);
             short column = std::stoi(lineParts[2]);
 
-            if (!Game::Field::isRowValid(row) || !Game::Field::isColumnInRowValid(column, row)) throw;
+            if (!Game::Field::isRowValid(row) || !Game::Field::isColumnInRowValid(column, row))
+                throw std::invalid_argument("Field is outside of the board");
 
-            fields.emplace_back(new Game::Field(state, row, column));
+            fields.emplace_back(state, row, column);
         });
 
-        return new Game::Board(fields);
+        return Game::Board(fields);
     } catch (const std::exception &) {
         return std::nullopt;
     }
@@ -8,13 +8,13 @@
 namespace FileManagement {
     class DeserializedGame {
     public:
-        Game::Teams *teams;
+        Game::Teams teams;
         Game::Side side;
-        Game::Board *board;
+        Game::Board board;
 
         DeserializedGame() = default;
 
-        DeserializedGame(Game::Teams *teams, Game::Side side, Game::Board *board);
+        DeserializedGame(Game::Teams teams, Game::Side side, Game::Board board);
     };
 
     class DeserializedRankingRecord {
@@ -39,11 +39,13 @@ namespace FileManagement {
 
         static std::string serializeBoard(const Game::Board &board);
 
-        static std::optional<Game::Teams *> deserializeTeams(std::vector<std::string> teamsLines);
+        static bool isSideValid(int side);
+
+        static std::optional<Game::Teams> deserializeTeams(std::vector<std::string> teamsLines);
 
         static std::optional<Game::Side> deserializeSide(const std::string &side);
 
-        static std::optional<Game::Board *> deserializeBoard(std::vector<std::string> boardLines);
+        static std::optional<Game::Board> deserializeBoard(std::vector<std::string> boardLines);
 
     public:
         static std::string serializeGame(const Game::Teams &teams, const Game::Side &side, const Game::Board &board);
@@ -0,0 +1,93 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PJC_HEXAGON_MMAP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+using namespace FileManagement;
+
+MappedFile::MappedFile(MappedFile &&other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this == &other) return *this;
+
+    release();
+
+    this->buffer = std::move(other.buffer);
+    this->isMapped = other.isMapped;
+    this->size = other.size;
+    // data of a vector stays in the same place after it is moved
+    this->data = this->isMapped ? other.data : this->buffer.data();
+
+    other.data = nullptr;
+    other.size = 0;
+    other.isMapped = false;
+
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+void MappedFile::release() {
+#ifdef PJC_HEXAGON_MMAP
+    if (this->isMapped) munmap(const_cast<unsigned char *>(this->data), this->size);
+#endif
+    this->data = nullptr;
+    this->size = 0;
+    this->isMapped = false;
+}
+
+std::optional<MappedFile> MappedFile::open(const std::string &fileName) {
+    MappedFile file;
+
+#ifdef PJC_HEXAGON_MMAP
+    int descriptor = ::open(fileName.c_str(), O_RDONLY);
+    if (descriptor < 0) return std::nullopt;
+
+    struct stat fileStatus{};
+    if (fstat(descriptor, &fileStatus) == 0 && fileStatus.st_size > 0) {
+        void *mapping = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (mapping != MAP_FAILED) {
+            file.data = static_cast<const unsigned char *>(mapping);
+            file.size = fileStatus.st_size;
+            file.isMapped = true;
+        }
+    }
+
+    // the mapping stays valid after the file is closed
+    close(descriptor);
+
+    if (file.isMapped) return file;
+#endif
+
+    std::ifstream stream(fileName, std::ios::binary);
+    if (!stream.is_open()) return std::nullopt;
+
+    file.buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    file.data = file.buffer.data();
+    file.size = file.buffer.size();
+
+    return file;
+}
+
+const unsigned char *MappedFile::getData() const {
+    return this->data;
+}
+
+std::size_t MappedFile::getSize() const {
+    return this->size;
+}
@@ -0,0 +1,51 @@
+#ifndef PJC_HEXAGON_MAPPEDFILE_H
+#define PJC_HEXAGON_MAPPEDFILE_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace FileManagement {
+    /**
+     * Read-only view of a whole file. On POSIX systems the file is memory mapped, so only the parts which are
+     * actually read get loaded, elsewhere the file is read into memory at once.
+     */
+    class MappedFile {
+    private:
+        const unsigned char *data = nullptr;
+        std::size_t size = 0;
+        // used when the file cannot be memory mapped
+        std::vector<unsigned char> buffer;
+        bool isMapped = false;
+
+        MappedFile() = default;
+
+        /**
+         * Unmaps the file, if it was mapped
+         */
+        void release();
+
+    public:
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        MappedFile(MappedFile &&other) noexcept;
+
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        ~MappedFile();
+
+        /**
+         * @return Null option if the file cannot be opened
+         */
+        static std::optional<MappedFile> open(const std::string &fileName);
+
+        const unsigned char *getData() const;
+
+        std::size_t getSize() const;
+    };
+}
+
+#endif //PJC_HEXAGON_MAPPEDFILE_H
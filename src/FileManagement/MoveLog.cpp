@@ -0,0 +1,63 @@
+#include "MoveLog.h"
+#include "BinaryGameSerializer.h"
+
+using namespace FileManagement;
+
+MoveLogWriter::MoveLogWriter(std::ostream &stream, std::uint16_t keyframeInterval)
+        : stream(stream), keyframeInterval(std::max<std::uint16_t>(keyframeInterval, 1)) {}
+
+std::uint16_t MoveLogWriter::encodeToken(MoveLogToken type, short from, short to) {
+    return static_cast<std::uint16_t>((from & 0x3F) | (to & 0x3F) << 6 | type << 12);
+}
+
+void MoveLogWriter::writeToken(MoveLogToken type, short from, short to) {
+    unsigned char token[2];
+    BinaryGameSerializer::writeNumber(token, encodeToken(type, from, to), 2);
+
+    this->stream.write(reinterpret_cast<const char *>(token), 2);
+}
+
+// header scheme: magic (4 bytes), version (2), keyframe interval (2), red team type (1), blue team type (1),
+// starting side (1), padding (1), red fields bitboard (8), blue fields bitboard (8)
+void MoveLogWriter::beginGame(const Game::Teams &teams, Game::Side startingSide, const Game::Board &board) {
+    unsigned char header[MOVE_LOG_HEADER_SIZE];
+    std::copy(std::begin(MOVE_LOG_MAGIC), std::end(MOVE_LOG_MAGIC), header);
+    BinaryGameSerializer::writeNumber(header + 4, MOVE_LOG_VERSION, 2);
+    BinaryGameSerializer::writeNumber(header + 6, this->keyframeInterval, 2);
+    BinaryGameSerializer::writeNumber(header + 8, teams.getRed().getType(), 1);
+    BinaryGameSerializer::writeNumber(header + 9, teams.getBlue().getType(), 1);
+    BinaryGameSerializer::writeNumber(header + 10, startingSide, 1);
+    BinaryGameSerializer::writeNumber(header + 11, 0, 1);
+    BinaryGameSerializer::writeNumber(header + 12, board.getSideCells(Game::RedSide), 8);
+    BinaryGameSerializer::writeNumber(header + 20, board.getSideCells(Game::BlueSide), 8);
+
+    this->stream.write(reinterpret_cast<const char *>(header), MOVE_LOG_HEADER_SIZE);
+    this->ply = 0;
+}
+
+void MoveLogWriter::recordMove(const Game::Board &board, std::optional<Game::Move> move) {
+    if (move.has_value())
+        writeToken(MoveToken, Game::Bitboards::cellIndex(move->from), Game::Bitboards::cellIndex(move->to));
+    else writeToken(PassToken, 0, 0);
+
+    this->ply++;
+
+    if (this->ply % this->keyframeInterval == 0) {
+        unsigned char keyframe[MOVE_LOG_KEYFRAME_SIZE];
+        BinaryGameSerializer::writeNumber(keyframe, board.getSideCells(Game::RedSide), 8);
+        BinaryGameSerializer::writeNumber(keyframe + 8, board.getSideCells(Game::BlueSide), 8);
+
+        writeToken(KeyframeToken, 0, 0);
+        this->stream.write(reinterpret_cast<const char *>(keyframe), MOVE_LOG_KEYFRAME_SIZE);
+    }
+}
+
+void MoveLogWriter::endGame() {
+    writeToken(EndToken, 0, 0);
+    this->stream.flush();
+}
+
+void MoveLogWriter::abandonGame() {
+    writeToken(AbandonToken, 0, 0);
+    this->stream.flush();
+}
@@ -0,0 +1,76 @@
+#ifndef PJC_HEXAGON_MOVELOG_H
+#define PJC_HEXAGON_MOVELOG_H
+
+#include <cstdint>
+#include <ostream>
+#include "../Game/Board.h"
+#include "../Game/Teams.h"
+
+namespace FileManagement {
+    // first bytes of every game in a move log
+    const unsigned char MOVE_LOG_MAGIC[4] = {'H', 'X', 'M', 'L'};
+    // has to be increased with every change of the layout of the header or the tokens
+    const std::uint16_t MOVE_LOG_VERSION = 1;
+    // magic, version, keyframe interval, team types, starting side, padding byte and the bitboards of the pawns
+    const std::size_t MOVE_LOG_HEADER_SIZE = 28;
+    // bitboards of the pawns follow the keyframe token
+    const std::size_t MOVE_LOG_KEYFRAME_SIZE = 16;
+    const std::uint16_t DEFAULT_KEYFRAME_INTERVAL = 16;
+
+    /**
+     * Every ply is saved as a 2 byte token: index of the field from which the pawn is moved (6 bits),
+     * index of the field to which it is moved (6 bits) and the type of the token (4 bits)
+     */
+    enum MoveLogToken {
+        MoveToken = 0,
+        // side had no legal moves and skipped its turn
+        PassToken = 1,
+        // followed by the bitboards of the board after the ply preceding the keyframe
+        KeyframeToken = 2,
+        EndToken = 3,
+        // game was left before its end, e.g. when a saved game got loaded instead
+        AbandonToken = 4,
+    };
+
+    /**
+     * Streams games as sequences of moves, every game starts with a header holding the teams and the starting
+     * position, and the board is saved as a keyframe after every \p keyframeInterval plies. Many games can be
+     * written to the same stream one after another, they can be read with \p GameReplay.
+     */
+    class MoveLogWriter {
+    private:
+        std::ostream &stream;
+        std::uint16_t keyframeInterval;
+        unsigned int ply = 0;
+
+        void writeToken(MoveLogToken type, short from, short to);
+
+    public:
+        /**
+         * @param stream Has to outlive the writer, every game is flushed to it when it ends
+         */
+        explicit MoveLogWriter(std::ostream &stream, std::uint16_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+
+        void beginGame(const Game::Teams &teams, Game::Side startingSide, const Game::Board &board);
+
+        /**
+         * @param board Board after the move and all of its consequences
+         * @param move Null option if the side skipped its turn
+         */
+        void recordMove(const Game::Board &board, std::optional<Game::Move> move);
+
+        void endGame();
+
+        /**
+         * Ends the game without finishing it, replays of abandoned games are not finished
+         */
+        void abandonGame();
+
+        /**
+         * Encoding shared with \p GameReplay
+         */
+        static std::uint16_t encodeToken(MoveLogToken type, short from, short to);
+    };
+}
+
+#endif //PJC_HEXAGON_MOVELOG_H
@@ -0,0 +1,141 @@
+#include "OpeningBook.h"
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <tuple>
+#include "BinaryGameSerializer.h"
+
+using namespace FileManagement;
+
+BookEntry::BookEntry(std::uint64_t key, short from, short to, std::uint16_t weight)
+        : key(key), from(from), to(to), weight(weight) {}
+
+OpeningBook::OpeningBook(MappedFile file, std::size_t entriesCount)
+        : file(std::move(file)), entriesCount(entriesCount) {}
+
+std::optional<OpeningBook> OpeningBook::open(const std::string &fileName) {
+    std::optional<MappedFile> file = MappedFile::open(fileName);
+    if (!file.has_value()) return std::nullopt;
+
+    const unsigned char *data = file->getData();
+    std::size_t size = file->getSize();
+    if (size < OPENING_BOOK_HEADER_SIZE ||
+        !std::equal(std::begin(OPENING_BOOK_MAGIC), std::end(OPENING_BOOK_MAGIC), data) ||
+        BinaryGameSerializer::readNumber(data + 4, 2) != OPENING_BOOK_VERSION ||
+        (size - OPENING_BOOK_HEADER_SIZE) % OPENING_BOOK_ENTRY_SIZE != 0)
+        return std::nullopt;
+
+    std::size_t entriesCount = (size - OPENING_BOOK_HEADER_SIZE) / OPENING_BOOK_ENTRY_SIZE;
+    return OpeningBook(std::move(file.value()), entriesCount);
+}
+
+bool OpeningBook::write(const std::string &fileName, std::vector<BookEntry> entries) {
+    std::sort(entries.begin(), entries.end(), [](const BookEntry &first, const BookEntry &second) {
+        return std::tie(first.key, first.from, first.to) < std::tie(second.key, second.from, second.to);
+    });
+
+    std::vector<unsigned char> data(OPENING_BOOK_HEADER_SIZE);
+    std::copy(std::begin(OPENING_BOOK_MAGIC), std::end(OPENING_BOOK_MAGIC), data.begin());
+    BinaryGameSerializer::writeNumber(data.data() + 4, OPENING_BOOK_VERSION, 2);
+
+    for (std::size_t i = 0; i < entries.size();) {
+        const BookEntry &entry = entries[i];
+        unsigned int weight = 0;
+
+        for (; i < entries.size() && entries[i].key == entry.key && entries[i].from == entry.from &&
+               entries[i].to == entry.to; i++)
+            weight += entries[i].weight;
+
+        std::size_t offset = data.size();
+        data.resize(offset + OPENING_BOOK_ENTRY_SIZE);
+        BinaryGameSerializer::writeNumber(data.data() + offset, entry.key, 8);
+        BinaryGameSerializer::writeNumber(data.data() + offset + 8, entry.from, 1);
+        BinaryGameSerializer::writeNumber(data.data() + offset + 9, entry.to, 1);
+        BinaryGameSerializer::writeNumber(
+                data.data() + offset + 10,
+                std::min<unsigned int>(weight, std::numeric_limits<std::uint16_t>::max()),
+                2);
+    }
+
+    std::ofstream stream(fileName, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    stream.close();
+
+    return !stream.fail();
+}
+
+std::uint64_t OpeningBook::getPositionKey(const Game::Board &board, Game::Side side) {
+    return board.getCanonicalKey(side).key;
+}
+
+BookEntry OpeningBook::createEntry(const Game::Board &board, Game::Side side, Game::CellMove move,
+                                   std::uint16_t weight) {
+    Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+    Game::CellMove canonicalMove = Game::Symmetries::transformMove(move, canonicalKey.symmetry);
+
+    return {canonicalKey.key, canonicalMove.from, canonicalMove.to, weight};
+}
+
+BookEntry OpeningBook::readEntry(std::size_t index) const {
+    const unsigned char *entry = this->file.getData() + OPENING_BOOK_HEADER_SIZE + index * OPENING_BOOK_ENTRY_SIZE;
+
+    return {BinaryGameSerializer::readNumber(entry, 8),
+            static_cast<short>(BinaryGameSerializer::readNumber(entry + 8, 1)),
+            static_cast<short>(BinaryGameSerializer::readNumber(entry + 9, 1)),
+            static_cast<std::uint16_t>(BinaryGameSerializer::readNumber(entry + 10, 2))};
+}
+
+std::size_t OpeningBook::lowerBound(std::uint64_t key) const {
+    std::size_t first = 0;
+    std::size_t count = this->entriesCount;
+
+    while (count > 0) {
+        std::size_t half = count / 2;
+
+        if (readEntry(first + half).key < key) {
+            first += half + 1;
+            count -= half + 1;
+        } else count = half;
+    }
+
+    return first;
+}
+
+std::vector<BookEntry> OpeningBook::findEntries(const Game::Board &board, Game::Side side) const {
+    Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+    std::vector<BookEntry> entries;
+
+    for (std::size_t i = lowerBound(canonicalKey.key); i < this->entriesCount; i++) {
+        BookEntry entry = readEntry(i);
+        if (entry.key != canonicalKey.key) break;
+        if (entry.from >= BOARD_CELLS_COUNT || entry.to >= BOARD_CELLS_COUNT) continue;
+
+        Game::CellMove move = Game::Symmetries::transformMove(Game::CellMove(entry.from, entry.to),
+                                                              canonicalKey.symmetry);
+        entries.emplace_back(entry.key, move.from, move.to, entry.weight);
+    }
+
+    return entries;
+}
+
+std::optional<Game::Move> OpeningBook::findMove(const Game::Board &board, Game::Side side) const {
+    std::optional<Game::Move> bestMove;
+    std::uint16_t bestWeight = 0;
+
+    for (const BookEntry &entry: findEntries(board, side)) {
+        Game::Move move(
+                Game::MoveUnit(Game::Bitboards::cellRow(entry.from), Game::Bitboards::cellUiColumn(entry.from)),
+                Game::MoveUnit(Game::Bitboards::cellRow(entry.to), Game::Bitboards::cellUiColumn(entry.to)));
+
+        if ((!bestMove.has_value() || entry.weight > bestWeight) && board.isMoveLegal(side, move)) {
+            bestMove = move;
+            bestWeight = entry.weight;
+        }
+    }
+
+    return bestMove;
+}
+
+std::size_t OpeningBook::getSize() const {
+    return this->entriesCount;
+}
@@ -0,0 +1,93 @@
+#ifndef PJC_HEXAGON_OPENINGBOOK_H
+#define PJC_HEXAGON_OPENINGBOOK_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../Game/Board.h"
+#include "MappedFile.h"
+
+namespace FileManagement {
+    // first bytes of every book file
+    const unsigned char OPENING_BOOK_MAGIC[4] = {'H', 'X', 'O', 'B'};
+    // has to be increased with every change of the layout of the header or the entries
+    const std::uint16_t OPENING_BOOK_VERSION = 2;
+    // magic, version and two padding bytes
+    const std::size_t OPENING_BOOK_HEADER_SIZE = 8;
+    // key (8 bytes), field from which the pawn is moved (1), field to which it is moved (1), weight (2)
+    const std::size_t OPENING_BOOK_ENTRY_SIZE = 12;
+
+    /**
+     * Move recommended in a position, moves with a higher weight are preferred. Equivalent positions share
+     * the entries, so the saved moves are the moves of the canonical position, see \p Game::Board::getCanonicalKey
+     */
+    class BookEntry {
+    public:
+        // see "OpeningBook::getPositionKey"
+        std::uint64_t key;
+        short from;
+        short to;
+        std::uint16_t weight;
+
+        BookEntry(std::uint64_t key, short from, short to, std::uint16_t weight);
+    };
+
+    /**
+     * Moves to be played in the known positions, saved as entries sorted by the key of the position. The file
+     * is memory mapped and searched with a binary search, so it never has to be loaded as a whole.
+     */
+    class OpeningBook {
+    private:
+        MappedFile file;
+        std::size_t entriesCount;
+
+        OpeningBook(MappedFile file, std::size_t entriesCount);
+
+        BookEntry readEntry(std::size_t index) const;
+
+        /**
+         * @return Index of the first entry with a key that is not lower than the \p key
+         */
+        std::size_t lowerBound(std::uint64_t key) const;
+
+    public:
+        /**
+         * @return Null option if the file cannot be read or is not a book
+         */
+        static std::optional<OpeningBook> open(const std::string &fileName);
+
+        /**
+         * Sorts the entries and saves them, entries with the same position and move are merged by adding up
+         * their weights
+         * @return False if the file cannot be written
+         */
+        static bool write(const std::string &fileName, std::vector<BookEntry> entries);
+
+        /**
+         * @return Key under which the moves are saved, the canonical key of the position
+         */
+        static std::uint64_t getPositionKey(const Game::Board &board, Game::Side side);
+
+        /**
+         * @param move Move made on the \p board, it is saved as the move of the canonical position
+         */
+        static BookEntry createEntry(const Game::Board &board, Game::Side side, Game::CellMove move,
+                                     std::uint16_t weight);
+
+        /**
+         * @return All the moves saved for the position, transformed back to the moves made on the \p board
+         */
+        std::vector<BookEntry> findEntries(const Game::Board &board, Game::Side side) const;
+
+        /**
+         * Keys of different positions can collide, so only the moves which are legal on the \p board are returned
+         * @return Legal move with the highest weight, null option if the position is not in the book
+         */
+        std::optional<Game::Move> findMove(const Game::Board &board, Game::Side side) const;
+
+        std::size_t getSize() const;
+    };
+}
+
+#endif //PJC_HEXAGON_OPENINGBOOK_H
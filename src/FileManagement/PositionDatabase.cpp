@@ -0,0 +1,253 @@
+#include "PositionDatabase.h"
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+using namespace FileManagement;
+
+DatabaseEntry::DatabaseEntry(std::string name, DeserializedGame game) : name(std::move(name)), game(std::move(game)) {}
+
+PositionDatabase::PositionDatabase(std::string fileName) : fileName(std::move(fileName)) {}
+
+std::unique_ptr<PositionDatabase> PositionDatabase::open(const std::string &fileName) {
+    std::unique_ptr<PositionDatabase> database(new PositionDatabase(fileName));
+
+    try {
+        if (!std::filesystem::exists(fileName)) {
+            unsigned char header[POSITION_DATABASE_HEADER_SIZE] = {};
+            std::copy(std::begin(POSITION_DATABASE_MAGIC), std::end(POSITION_DATABASE_MAGIC), header);
+            BinaryGameSerializer::writeNumber(header + 4, POSITION_DATABASE_VERSION, 2);
+
+            std::ofstream stream(fileName, std::ios::binary);
+            stream.write(reinterpret_cast<const char *>(header), POSITION_DATABASE_HEADER_SIZE);
+            stream.close();
+            if (stream.fail()) return nullptr;
+        }
+
+        database->log = MappedFile::open(fileName);
+        if (!database->log.has_value()) return nullptr;
+
+        const unsigned char *data = database->log->getData();
+        std::size_t size = database->log->getSize();
+        if (size < POSITION_DATABASE_HEADER_SIZE ||
+            !std::equal(std::begin(POSITION_DATABASE_MAGIC), std::end(POSITION_DATABASE_MAGIC), data) ||
+            BinaryGameSerializer::readNumber(data + 4, 2) != POSITION_DATABASE_VERSION)
+            return nullptr;
+
+        std::size_t offset = POSITION_DATABASE_HEADER_SIZE;
+        while (offset != size) {
+            std::optional<std::size_t> entrySize = database->readEntrySize(offset);
+
+            if (!entrySize.has_value()) {
+                // entries after a corrupted one would be lost by the truncation, so the database is not opened
+                if (database->isEntryComplete(offset)) return nullptr;
+                break;
+            }
+
+            database->indexEntry(offset);
+            offset += entrySize.value();
+        }
+
+        // incomplete entry after the last valid one was left by an interrupted write
+        if (offset != size) {
+            database->log.reset();
+            std::filesystem::resize_file(fileName, offset);
+            database->log = MappedFile::open(fileName);
+            if (!database->log.has_value()) return nullptr;
+        }
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+
+    return database;
+}
+
+std::uint64_t PositionDatabase::getPositionKey(const Game::Board &board, Game::Side side) {
+    return board.getCanonicalKey(side).key;
+}
+
+bool PositionDatabase::isEntryComplete(std::size_t offset) const {
+    const unsigned char *data = this->log->getData();
+    std::size_t size = this->log->getSize();
+
+    if (offset + 2 > size) return false;
+
+    std::size_t nameLength = BinaryGameSerializer::readNumber(data + offset, 2);
+    return offset + 2 + nameLength + BINARY_SAVE_RECORD_SIZE + 4 <= size;
+}
+
+std::optional<std::size_t> PositionDatabase::readEntrySize(std::size_t offset) const {
+    if (!isEntryComplete(offset)) return std::nullopt;
+
+    const unsigned char *data = this->log->getData();
+    std::size_t nameLength = BinaryGameSerializer::readNumber(data + offset, 2);
+    std::size_t entrySize = 2 + nameLength + BINARY_SAVE_RECORD_SIZE + 4;
+
+    std::size_t checksumOffset = offset + entrySize - 4;
+    if (BinaryGameSerializer::readNumber(data + checksumOffset, 4) !=
+        BinaryGameSerializer::checksum(data + offset, entrySize - 4))
+        return std::nullopt;
+
+    // record has its own checksum, it is checked in order to reject the invalid games as well
+    if (!BinaryGameSerializer::readRecord(data + offset + 2 + nameLength).has_value()) return std::nullopt;
+
+    return entrySize;
+}
+
+DatabaseEntry PositionDatabase::readEntry(std::size_t offset) const {
+    const unsigned char *data = this->log->getData();
+    std::size_t nameLength = BinaryGameSerializer::readNumber(data + offset, 2);
+
+    // entries are validated before they get indexed, so the record is always valid
+    return {std::string(reinterpret_cast<const char *>(data + offset + 2), nameLength),
+            BinaryGameSerializer::readRecord(data + offset + 2 + nameLength).value()};
+}
+
+void PositionDatabase::indexEntry(std::size_t offset) {
+    DatabaseEntry entry = readEntry(offset);
+    auto sameName = this->entriesByName.find(entry.name);
+    std::size_t index;
+
+    if (sameName == this->entriesByName.end()) {
+        index = this->entryOffsets.size();
+        this->entryOffsets.emplace_back(offset);
+        this->entriesByName.emplace(entry.name, index);
+    } else {
+        index = sameName->second;
+
+        DatabaseEntry replacedEntry = readEntry(this->entryOffsets[index]);
+        auto positionEntries = this->entriesByPosition.equal_range(
+                getPositionKey(replacedEntry.game.board, replacedEntry.game.side));
+        for (auto positionEntry = positionEntries.first; positionEntry != positionEntries.second; positionEntry++) {
+            if (positionEntry->second == index) {
+                this->entriesByPosition.erase(positionEntry);
+                break;
+            }
+        }
+
+        this->entryOffsets[index] = offset;
+    }
+
+    this->entriesByPosition.emplace(getPositionKey(entry.game.board, entry.game.side), index);
+}
+
+std::vector<unsigned char> PositionDatabase::serializeEntry(
+        const std::string &name,
+        const Game::Teams &teams,
+        Game::Side side,
+        const Game::Board &board) {
+    std::vector<unsigned char> entry(2 + name.size() + BINARY_SAVE_RECORD_SIZE + 4);
+
+    BinaryGameSerializer::writeNumber(entry.data(), name.size(), 2);
+    std::copy(name.begin(), name.end(), entry.begin() + 2);
+    BinaryGameSerializer::writeRecord(entry.data() + 2 + name.size(), teams, side, board);
+    BinaryGameSerializer::writeNumber(
+            entry.data() + entry.size() - 4,
+            BinaryGameSerializer::checksum(entry.data(), entry.size() - 4),
+            4);
+
+    return entry;
+}
+
+bool PositionDatabase::save(
+        const std::string &name,
+        const Game::Teams &teams,
+        Game::Side side,
+        const Game::Board &board) {
+    return saveAll({DatabaseEntry(name, DeserializedGame(teams, side, board))});
+}
+
+bool PositionDatabase::saveAll(const std::vector<DatabaseEntry> &entries) {
+    std::vector<unsigned char> data;
+
+    for (const DatabaseEntry &entry: entries) {
+        if (entry.name.size() > MAX_POSITION_NAME_LENGTH) return false;
+
+        std::vector<unsigned char> serializedEntry =
+                serializeEntry(entry.name, entry.game.teams, entry.game.side, entry.game.board);
+        data.insert(data.end(), serializedEntry.begin(), serializedEntry.end());
+    }
+
+    std::unique_lock lock(this->mutex);
+
+    try {
+        // mapping always ends after the last valid entry, anything after it was left by a failed write
+        std::size_t offset = this->log->getSize();
+        if (std::filesystem::file_size(this->fileName) != offset) std::filesystem::resize_file(this->fileName, offset);
+
+        std::ofstream stream(this->fileName, std::ios::binary | std::ios::app);
+        stream.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+        stream.close();
+        if (stream.fail()) {
+            std::filesystem::resize_file(this->fileName, offset);
+            return false;
+        }
+
+        // mapping covers only the part of the file that existed when it was created, the old one is kept until
+        // the new one is created, so a failed mapping leaves the database as it was before the save
+        std::optional<MappedFile> extendedLog = MappedFile::open(this->fileName);
+        if (!extendedLog.has_value()) {
+            std::filesystem::resize_file(this->fileName, offset);
+            return false;
+        }
+        this->log = std::move(extendedLog);
+
+        for (const DatabaseEntry &entry: entries) {
+            indexEntry(offset);
+            offset += 2 + entry.name.size() + BINARY_SAVE_RECORD_SIZE + 4;
+        }
+    } catch (const std::exception &) {
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<DeserializedGame> PositionDatabase::findByName(const std::string &name) const {
+    std::shared_lock lock(this->mutex);
+
+    auto entry = this->entriesByName.find(name);
+    if (entry == this->entriesByName.end()) return std::nullopt;
+
+    return readEntry(this->entryOffsets[entry->second]).game;
+}
+
+std::vector<DatabaseEntry> PositionDatabase::findByPosition(const Game::Board &board, Game::Side side) const {
+    std::shared_lock lock(this->mutex);
+    std::vector<DatabaseEntry> entries;
+
+    Game::CanonicalKey canonicalKey = board.getCanonicalKey(side);
+    Game::Board canonicalBoard = board.transformed(canonicalKey.symmetry);
+    Game::Side canonicalSide = Game::Symmetries::transformSide(side, canonicalKey.symmetry);
+
+    auto positionEntries = this->entriesByPosition.equal_range(canonicalKey.key);
+    for (auto positionEntry = positionEntries.first; positionEntry != positionEntries.second; positionEntry++) {
+        DatabaseEntry entry = readEntry(this->entryOffsets[positionEntry->second]);
+
+        // keys of different positions can collide, so the canonical forms of the found boards are compared with
+        // the canonical form of the searched one
+        Game::Symmetry entrySymmetry = entry.game.board.getCanonicalKey(entry.game.side).symmetry;
+        Game::Board entryBoard = entry.game.board.transformed(entrySymmetry);
+
+        if (Game::Symmetries::transformSide(entry.game.side, entrySymmetry) == canonicalSide &&
+            entryBoard.getSideCells(Game::RedSide) == canonicalBoard.getSideCells(Game::RedSide) &&
+            entryBoard.getSideCells(Game::BlueSide) == canonicalBoard.getSideCells(Game::BlueSide))
+            entries.emplace_back(entry);
+    }
+
+    return entries;
+}
+
+void PositionDatabase::scan(const std::function<bool(const DatabaseEntry &)> &visitor) const {
+    std::shared_lock lock(this->mutex);
+
+    for (std::size_t offset: this->entryOffsets) {
+        if (!visitor(readEntry(offset))) return;
+    }
+}
+
+std::size_t PositionDatabase::getSize() const {
+    std::shared_lock lock(this->mutex);
+
+    return this->entryOffsets.size();
+}
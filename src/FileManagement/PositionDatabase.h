@@ -0,0 +1,122 @@
+#ifndef PJC_HEXAGON_POSITIONDATABASE_H
+#define PJC_HEXAGON_POSITIONDATABASE_H
+
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include "BinaryGameSerializer.h"
+#include "MappedFile.h"
+
+namespace FileManagement {
+    // first bytes of every database file
+    const unsigned char POSITION_DATABASE_MAGIC[4] = {'H', 'X', 'D', 'B'};
+    // has to be increased with every change of the layout of the header or the entries
+    const std::uint16_t POSITION_DATABASE_VERSION = 1;
+    // magic, version and two padding bytes
+    const std::size_t POSITION_DATABASE_HEADER_SIZE = 8;
+    // names are saved with their length in 2 bytes
+    const std::size_t MAX_POSITION_NAME_LENGTH = 65535;
+
+    class DatabaseEntry {
+    public:
+        std::string name;
+        DeserializedGame game;
+
+        DatabaseEntry(std::string name, DeserializedGame game);
+    };
+
+    /**
+     * Many games saved in a single file. The file is an append-only log of entries, saving a game under a name
+     * which is already taken appends a new entry which replaces the old one. Indexes by the name and by
+     * the position are kept in memory, they are rebuilt by scanning the log when the database is opened.
+     * The log is memory mapped, any count of threads can read at the same time, writes are exclusive.
+     */
+    class PositionDatabase {
+    private:
+        std::string fileName;
+        // always mapped once the database is opened, it is replaced only by a successfully created mapping
+        std::optional<MappedFile> log;
+        // offsets of the newest entries for every name, in the order in which the names were first saved
+        std::vector<std::size_t> entryOffsets;
+        // index in the "entryOffsets" by the name
+        std::unordered_map<std::string, std::size_t> entriesByName;
+        // indexes in the "entryOffsets" by the key of the position, see "getPositionKey"
+        std::unordered_multimap<std::uint64_t, std::size_t> entriesByPosition;
+        mutable std::shared_mutex mutex;
+
+        explicit PositionDatabase(std::string fileName);
+
+        /**
+         * @return True if the bytes from the \p offset to the end of the log can hold the whole entry, based on its
+         * name length
+         */
+        bool isEntryComplete(std::size_t offset) const;
+
+        /**
+         * Entry scheme: name length (2 bytes), name, game record (\p BINARY_SAVE_RECORD_SIZE bytes),
+         * checksum of all the previous bytes (4 bytes)
+         * @return Size of the valid entry starting at the \p offset, null option if it is incomplete or corrupted
+         */
+        std::optional<std::size_t> readEntrySize(std::size_t offset) const;
+
+        DatabaseEntry readEntry(std::size_t offset) const;
+
+        /**
+         * Adds the entry to the indexes, the previous entry with the same name is removed from them
+         */
+        void indexEntry(std::size_t offset);
+
+        static std::vector<unsigned char> serializeEntry(const std::string &name, const Game::Teams &teams,
+                                                         Game::Side side, const Game::Board &board);
+
+    public:
+        PositionDatabase(const PositionDatabase &) = delete;
+
+        PositionDatabase &operator=(const PositionDatabase &) = delete;
+
+        /**
+         * Opens the database or creates it if the file does not exist. Incomplete entry at the end of the log,
+         * left by an interrupted write, is removed.
+         * @return Null pointer if the file cannot be read, is not a database or contains a complete entry which
+         * is corrupted
+         */
+        static std::unique_ptr<PositionDatabase> open(const std::string &fileName);
+
+        /**
+         * @return Key under which the position is indexed, the canonical key shared by the equivalent positions,
+         * see \p Game::Board::getCanonicalKey
+         */
+        static std::uint64_t getPositionKey(const Game::Board &board, Game::Side side);
+
+        /**
+         * Saves the game at the end of the log, replacing the game saved earlier under the same \p name
+         * @return False if the name is too long or the file cannot be written
+         */
+        bool save(const std::string &name, const Game::Teams &teams, Game::Side side, const Game::Board &board);
+
+        /**
+         * Saves all the \p entries with a single write
+         */
+        bool saveAll(const std::vector<DatabaseEntry> &entries);
+
+        std::optional<DeserializedGame> findByName(const std::string &name) const;
+
+        /**
+         * @return All the saved games in which the \p board is in the same state and the same \p side makes a move,
+         * or which are equivalent to it, e.g. mirrored or with the colours swapped
+         */
+        std::vector<DatabaseEntry> findByPosition(const Game::Board &board, Game::Side side) const;
+
+        /**
+         * Visits all the saved games in the order in which their names were first saved. Other threads can read
+         * the database at the same time, but they cannot save games until the scan is finished
+         * @param visitor Returns false in order to stop the scan
+         */
+        void scan(const std::function<bool(const DatabaseEntry &entry)> &visitor) const;
+
+        std::size_t getSize() const;
+    };
+}
+
+#endif //PJC_HEXAGON_POSITIONDATABASE_H
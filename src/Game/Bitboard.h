@@ -0,0 +1,195 @@
+#ifndef PJC_HEXAGON_BITBOARD_H
+#define PJC_HEXAGON_BITBOARD_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include "../Consts.h"
+#include "Field.h"
+#include "Move.h"
+
+namespace Game {
+    // every field of the board is represented by a single bit, fields are indexed row by row
+    // and from left to right inside a row, so the order of bits matches the order of fields in the board's rows
+    typedef std::uint64_t Bitboard;
+
+    // returned for positions which point to an empty space between the fields or outside the board
+    const short NO_CELL = -1;
+
+    // (row, uiColumn) modifiers pointing to the fields bordering a field
+    constexpr short BORDERING_ROW_MODIFIERS[6] = {-1, -1, -2, 1, 1, 2};
+    constexpr short BORDERING_UI_COLUMN_MODIFIERS[6] = {-1, 1, 0, -1, 1, 0};
+
+    // (row, uiColumn) modifiers pointing to the fields one field away from a field
+    constexpr short NON_BORDERING_ROW_MODIFIERS[12] = {-4, -3, -2, 0, 2, 3, 4, 3, 2, 0, -2, -3};
+    constexpr short NON_BORDERING_UI_COLUMN_MODIFIERS[12] = {0, 1, 2, 2, 2, 1, 0, -1, -2, -2, -2, -1};
+
+    /**
+     * Indexes of the fields found around a field, kept in the same order as the modifiers used to find them.
+     */
+    class CellList {
+    public:
+        std::array<short, 12> cells{};
+        short size = 0;
+
+        constexpr const short *begin() const {
+            return cells.data();
+        }
+
+        constexpr const short *end() const {
+            return cells.data() + size;
+        }
+    };
+
+    /**
+     * Lookup tables describing the board's geometry, generated at compile time.
+     */
+    class CellTables {
+    public:
+        std::array<std::array<short, BOARD_COLUMNS_COUNT>, BOARD_ROWS_COUNT> indexByUiColumn{};
+        std::array<short, BOARD_ROWS_COUNT> rowStart{};
+        std::array<unsigned short, BOARD_CELLS_COUNT> row{};
+        std::array<unsigned short, BOARD_CELLS_COUNT> column{};
+        std::array<unsigned short, BOARD_CELLS_COUNT> uiColumn{};
+        std::array<Bitboard, BOARD_CELLS_COUNT> bordering{};
+        std::array<Bitboard, BOARD_CELLS_COUNT> nonBordering{};
+        std::array<CellList, BOARD_CELLS_COUNT> borderingList{};
+        std::array<CellList, BOARD_CELLS_COUNT> nonBorderingList{};
+
+        constexpr CellTables() {
+            short cellIndex = 0;
+
+            for (short r = 0; r < BOARD_ROWS_COUNT; r++) {
+                indexByUiColumn[r].fill(NO_CELL);
+                rowStart[r] = cellIndex;
+
+                for (short c = 0; c < Field::columnsInRowByRowIndex(r); c++) {
+                    short uiC = Field::uiColumnByColumn(c, r);
+
+                    indexByUiColumn[r][uiC] = cellIndex;
+                    row[cellIndex] = r;
+                    column[cellIndex] = c;
+                    uiColumn[cellIndex] = uiC;
+                    cellIndex++;
+                }
+            }
+
+            for (short i = 0; i < BOARD_CELLS_COUNT; i++) {
+                for (short m = 0; m < 6; m++)
+                    addAround(borderingList[i], bordering[i],
+                              static_cast<short>(row[i] + BORDERING_ROW_MODIFIERS[m]),
+                              static_cast<short>(uiColumn[i] + BORDERING_UI_COLUMN_MODIFIERS[m]));
+                for (short m = 0; m < 12; m++)
+                    addAround(nonBorderingList[i], nonBordering[i],
+                              static_cast<short>(row[i] + NON_BORDERING_ROW_MODIFIERS[m]),
+                              static_cast<short>(uiColumn[i] + NON_BORDERING_UI_COLUMN_MODIFIERS[m]));
+            }
+        }
+
+    private:
+        constexpr void addAround(CellList &list, Bitboard &mask, short r, short uiC) const {
+            if (r < 0 || r >= BOARD_ROWS_COUNT || uiC < 0 || uiC >= BOARD_COLUMNS_COUNT) return;
+            if (indexByUiColumn[r][uiC] == NO_CELL) return;
+
+            list.cells[list.size++] = indexByUiColumn[r][uiC];
+            mask |= Bitboard(1) << indexByUiColumn[r][uiC];
+        }
+    };
+
+    constexpr CellTables CELL_TABLES;
+
+    /**
+     * Fixed mapping between the fields and their bits, as well as helpers for operating on bitboards.
+     */
+    class Bitboards {
+    public:
+        static constexpr Bitboard ALL_CELLS = (Bitboard(1) << BOARD_CELLS_COUNT) - 1;
+
+        /**
+         * @return Index of the field's bit, or \p NO_CELL if there is no field at the given position
+         */
+        static constexpr short cellIndex(short row, short uiColumn) {
+            if (row < 0 || row >= BOARD_ROWS_COUNT || uiColumn < 0 || uiColumn >= BOARD_COLUMNS_COUNT)
+                return NO_CELL;
+            return CELL_TABLES.indexByUiColumn[row][uiColumn];
+        }
+
+        /**
+         * @return Index of the field pointed to by the \p moveUnit, or \p NO_CELL if there is none
+         */
+        static short cellIndex(MoveUnit moveUnit) {
+            return cellIndex(static_cast<short>(moveUnit.row), static_cast<short>(moveUnit.uiColumn));
+        }
+
+        /**
+         * Works the same as \p cellIndex, but uses the column index of a field inside its row.
+         */
+        static constexpr short cellIndexByColumn(short row, short column) {
+            return static_cast<short>(CELL_TABLES.rowStart[row] + column);
+        }
+
+        static constexpr unsigned short cellRow(short cellIndex) {
+            return CELL_TABLES.row[cellIndex];
+        }
+
+        static constexpr unsigned short cellColumn(short cellIndex) {
+            return CELL_TABLES.column[cellIndex];
+        }
+
+        static constexpr unsigned short cellUiColumn(short cellIndex) {
+            return CELL_TABLES.uiColumn[cellIndex];
+        }
+
+        static constexpr Bitboard cellMask(short cellIndex) {
+            return Bitboard(1) << cellIndex;
+        }
+
+        /**
+         * @return Mask of the fields bordering the field, moves to them duplicate the pawn
+         */
+        static constexpr Bitboard borderingCells(short cellIndex) {
+            return CELL_TABLES.bordering[cellIndex];
+        }
+
+        /**
+         * @return Mask of the fields one field away from the field, moves to them relocate the pawn
+         */
+        static constexpr Bitboard nonBorderingCells(short cellIndex) {
+            return CELL_TABLES.nonBordering[cellIndex];
+        }
+
+        /**
+         * @return Same fields as \p borderingCells, in the order of \p BORDERING_ROW_MODIFIERS
+         */
+        static constexpr const CellList &borderingCellsList(short cellIndex) {
+            return CELL_TABLES.borderingList[cellIndex];
+        }
+
+        /**
+         * @return Same fields as \p nonBorderingCells, in the order of \p NON_BORDERING_ROW_MODIFIERS
+         */
+        static constexpr const CellList &nonBorderingCellsList(short cellIndex) {
+            return CELL_TABLES.nonBorderingList[cellIndex];
+        }
+
+        static constexpr short count(Bitboard bitboard) {
+            return static_cast<short>(std::popcount(bitboard));
+        }
+
+        /**
+         * Removes the lowest set bit from the \p bitboard
+         * @return Index of the removed bit, \p bitboard must not be empty
+         */
+        static constexpr short popLowestCell(Bitboard &bitboard) {
+            auto cellIndex = static_cast<short>(std::countr_zero(bitboard));
+            bitboard &= bitboard - 1;
+            return cellIndex;
+        }
+    };
+
+    static_assert(BOARD_CELLS_COUNT <= 64, "Every field has to fit in a single bitboard");
+    static_assert(Bitboards::cellIndex(BOARD_ROWS_COUNT - 1, BOARD_COLUMNS_COUNT / 2) == BOARD_CELLS_COUNT - 1,
+                  "Last field has to be mapped to the last bit");
+}
+
+#endif //PJC_HEXAGON_BITBOARD_H
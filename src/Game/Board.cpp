@@ -1,300 +1,413 @@
+#include <atomic>
+#include <cassert>
 #include <iostream>
 #include "Board.h"
+#include "CaptureCounter.h"
 
 using namespace Game;
 
-Board::Board(const std::vector<Field *> &initialFields) {
-    std::vector<Field *> allInitialFields = REQUIRED_INITIAL_FIELDS;
-    allInitialFields.insert(allInitialFields.end(), initialFields.begin(), initialFields.end());
+UndoRecord::UndoRecord(Side side, short from, short to, Bitboard convertedCells) {
+    this->side = side;
+    this->from = from;
+    this->to = to;
+    this->convertedCells = convertedCells;
+}
 
-    for (short row = 0; row < BOARD_ROWS_COUNT; row++) {
+Board::Board() : Board(getInitialPosition()) {}
 
-        std::vector<Field *> fieldsRow;
+const Board &Board::getInitialPosition() {
+    // initialization of a static local variable is thread safe, so boards can be created on any thread
+    static const Board initialPosition(INITIAL_FIELDS);
 
-        short columns = Field::columnsInRowByRowIndex(row);
+    return initialPosition;
+}
 
-        // fills the board with "FieldState::Empty" fields, but if there is a field with different state
-        // specified in the "initialFields", it's being used instead
-        for (short column = 0; column < columns; column++) {
-            auto initialField = std::find_if(
-                    allInitialFields.begin(),
-                    allInitialFields.end(),
-                    [row, column](Field *f) -> bool {
-                        return f->getRow() == row && f->getColumn() == column;
-                    });
+Board Board::fromBitboards(Bitboard redCells, Bitboard blueCells) {
+    static const Board emptyPosition(std::vector<Field>{});
 
-            if (initialField != std::end(allInitialFields)) {
-                fieldsRow.emplace_back(allInitialFields[std::distance(allInitialFields.begin(), initialField)]);
-                continue;
-            }
+    if ((redCells & blueCells) != 0 || ((redCells | blueCells) & ~emptyPosition.getEmptyCells()) != 0)
+        throw std::invalid_argument("Bitboards do not describe a valid board");
+
+    Board board = emptyPosition;
+
+    while (redCells != 0) board.setCellState(Bitboards::popLowestCell(redCells), Red);
+    while (blueCells != 0) board.setCellState(Bitboards::popLowestCell(blueCells), Blue);
+
+    return board;
+}
+
+Board::Board(const std::vector<Field> &initialFields) {
+    // fills the board with "FieldState::Empty" fields
+    for (short cellIndex = 0; cellIndex < BOARD_CELLS_COUNT; cellIndex++) {
+        this->cells[cellIndex] = Field(
+                Empty,
+                Bitboards::cellRow(cellIndex),
+                Bitboards::cellColumn(cellIndex));
+    }
 
-            fieldsRow.emplace_back(new Field(Empty, row, column));
+    // fields specified in the "initialFields" are used instead of the empty ones,
+    // "REQUIRED_INITIAL_FIELDS" are copied last, so they cannot be overridden
+    for (const std::vector<Field> *fieldsToCopy: {&initialFields, &REQUIRED_INITIAL_FIELDS}) {
+        for (const Field &field: *fieldsToCopy) {
+            this->cells[Bitboards::cellIndexByColumn(
+                    static_cast<short>(field.getRow()),
+                    static_cast<short>(field.getColumn()))] = field;
         }
+    }
 
-        fields[row] = fieldsRow;
+    for (short cellIndex = 0; cellIndex < BOARD_CELLS_COUNT; cellIndex++) {
+        Bitboard cellMask = Bitboards::cellMask(cellIndex);
+        FieldState state = getFieldByCellIndex(cellIndex)->getState();
+        // the state indexes the counts and the keys, loaders have to reject anything else
+        assert(state >= Empty && state <= Blue);
+
+        for (short symmetry = 0; symmetry < SYMMETRIES_COUNT; symmetry++)
+            this->hashes[symmetry] ^= Symmetries::cellKey(cellIndex, state, static_cast<Symmetry>(symmetry));
+        this->stateCounts[state]++;
+
+        switch (state) {
+            case Red:
+                redCells |= cellMask;
+                break;
+            case Blue:
+                blueCells |= cellMask;
+                break;
+            case Blocked:
+                blockedCells |= cellMask;
+                break;
+            case Empty:
+                break;
+        }
     }
 }
 
-std::array<std::vector<Field *>, BOARD_ROWS_COUNT> Board::getFields() const {
-    return this->fields;
+void Board::setCellState(short cellIndex, FieldState state) {
+    Field &field = this->cells[cellIndex];
+    FieldState previousState = field.getState();
+
+    field.setState(state);
+    for (short symmetry = 0; symmetry < SYMMETRIES_COUNT; symmetry++) {
+        this->hashes[symmetry] ^= Symmetries::cellKey(cellIndex, previousState, static_cast<Symmetry>(symmetry)) ^
+                                  Symmetries::cellKey(cellIndex, state, static_cast<Symmetry>(symmetry));
+    }
+    this->stateCounts[previousState]--;
+    this->stateCounts[state]++;
+    this->legalMoveCache = {-1, -1};
+
+    Bitboard cellMask = Bitboards::cellMask(cellIndex);
+    redCells &= ~cellMask;
+    blueCells &= ~cellMask;
+
+    if (state == Red) redCells |= cellMask;
+    else if (state == Blue) blueCells |= cellMask;
 }
 
-bool Board::isGameFinished() const {
-    bool redFound = false;
-    bool blueFound = false;
-    bool emptyFound = false;
-
-    for (int i = 0; i < this->fields.size(); i++) {
-        for (auto it = fields[i].begin(); it < fields[i].end(); it++) {
-            if ((*it)->getState() == Red) {
-                redFound = true;
-                continue;
-            }
-            if ((*it)->getState() == Blue) {
-                blueFound = true;
-                continue;
-            }
-            if ((*it)->getState() == Empty) {
-                emptyFound = true;
-                continue;
-            }
+const Field *Board::getFieldByCellIndex(short cellIndex) const {
+    return &this->cells[cellIndex];
+}
+
+Bitboard Board::getSideCells(Side side) const {
+    return side == RedSide ? this->redCells : this->blueCells;
+}
+
+Bitboard Board::getEmptyCells() const {
+    return Bitboards::ALL_CELLS & ~(this->redCells | this->blueCells | this->blockedCells);
+}
+
+Bitboard Board::getBlockedCells() const {
+    return this->blockedCells;
+}
+
+bool Board::hasLegalMove(Side side) const {
+    std::atomic_ref<signed char> cachedResult(this->legalMoveCache[side]);
+    signed char result = cachedResult.load(std::memory_order_relaxed);
+    if (result >= 0) return result != 0;
+
+    Bitboard emptyCells = getEmptyCells();
+    result = 0;
+
+    for (Bitboard sideCells = getSideCells(side); sideCells != 0;) {
+        short cellIndex = Bitboards::popLowestCell(sideCells);
+
+        if (((Bitboards::borderingCells(cellIndex) | Bitboards::nonBorderingCells(cellIndex)) & emptyCells) != 0) {
+            result = 1;
+            break;
         }
+    }
+
+    cachedResult.store(result, std::memory_order_relaxed);
+    return result != 0;
+}
+
+std::span<const Field> Board::getRow(short row) const {
+    return {&this->cells[Bitboards::cellIndexByColumn(row, 0)],
+            static_cast<std::size_t>(Field::columnsInRowByRowIndex(row))};
+}
+
+std::span<const Field, BOARD_CELLS_COUNT> Board::getCells() const {
+    return std::span<const Field, BOARD_CELLS_COUNT>(this->cells);
+}
+
+FieldState Board::getCellState(short cellIndex) const {
+    return this->cells[cellIndex].getState();
+}
+
+bool Board::isGameFinished() const {
+    return this->stateCounts[Red] == 0 || this->stateCounts[Blue] == 0 || this->stateCounts[Empty] == 0;
+}
+
+std::uint64_t Board::getHash() const {
+    return this->hashes[Identity];
+}
+
+CanonicalKey Board::getCanonicalKey(Side side) const {
+    CanonicalKey canonicalKey(this->hashes[Identity] ^ Zobrist::sideKey(side), Identity);
 
-        if (redFound && blueFound && emptyFound) return false;
+    for (short i = 1; i < SYMMETRIES_COUNT; i++) {
+        auto symmetry = static_cast<Symmetry>(i);
+        std::uint64_t key = this->hashes[symmetry] ^ Zobrist::sideKey(Symmetries::transformSide(side, symmetry));
+
+        if (key < canonicalKey.key) canonicalKey = CanonicalKey(key, symmetry);
     }
 
-    return true;
+    return canonicalKey;
 }
 
-bool Board::isMoveLegal(Side side, Move move) const {
-    std::optional<Field *> fieldFromOption = getFieldByMoveUnit(move.from);
-    std::optional<Field *> fieldToOption = getFieldByMoveUnit(move.to);
-
-    if (!fieldFromOption.has_value() || !fieldToOption.has_value()) return false;
-
-    Field *fieldFrom = fieldFromOption.value();
-    Field *fieldTo = fieldToOption.value();
-
-    if (fieldFrom->getState() != Team::sideToFieldStatus(side)) return false;
-
-    if (fieldTo->getState() != Empty) return false;
-
-    // checks if move complies with the rules:
-    // checks horizontal distance
-    if (fieldFrom->getRow() == fieldTo->getRow() && abs(fieldTo->getUiColumn() - fieldFrom->getUiColumn()) != 2)
-        return false;
-    // checks vertical distance, 4 stands for 2 rows
-    if (fieldFrom->getUiColumn() == fieldTo->getUiColumn() && abs(fieldTo->getRow() - fieldFrom->getRow()) > 4)
-        return false;
-    // checks diagonals
-    if ((abs(fieldFrom->getRow() - fieldTo->getRow()) == 1 || abs(fieldFrom->getRow() - fieldTo->getRow()) == 3) &&
-        abs(fieldFrom->getUiColumn() - fieldTo->getUiColumn()) > 1)
-        return false;
-    if (abs(fieldFrom->getRow() - fieldTo->getRow()) == 2 &&
-        abs(fieldFrom->getUiColumn() - fieldTo->getUiColumn()) > 2)
-        return false;
-
-    return true;
+Board Board::transformed(Symmetry symmetry) const {
+    return fromBitboards(
+            Symmetries::transformCells(getSideCells(Symmetries::transformSide(RedSide, symmetry)), symmetry),
+            Symmetries::transformCells(getSideCells(Symmetries::transformSide(BlueSide, symmetry)), symmetry));
 }
 
-void Board::makeMove(Side side, Move move) const {
-    Field *fieldFrom = getFieldByMoveUnit(move.from).value();
-    Field *fieldTo = getFieldByMoveUnit(move.to).value();
+bool Board::isMoveLegal(Side side, Move move) const {
+    short from = Bitboards::cellIndex(static_cast<short>(move.from.row), static_cast<short>(move.from.uiColumn));
+    short to = Bitboards::cellIndex(static_cast<short>(move.to.row), static_cast<short>(move.to.uiColumn));
+
+    if (from == NO_CELL || to == NO_CELL) return false;
+
+    if ((getSideCells(side) & Bitboards::cellMask(from)) == 0) return false;
+
+    if ((getEmptyCells() & Bitboards::cellMask(to)) == 0) return false;
 
+    // checks if move complies with the rules, pawn can be moved only to the fields bordering the original field,
+    // or to the fields one field away from it
+    return ((Bitboards::borderingCells(from) | Bitboards::nonBorderingCells(from)) & Bitboards::cellMask(to)) != 0;
+}
+
+UndoRecord Board::makeMove(Side side, Move move) {
     if (!isMoveLegal(side, move)) {
         throw std::logic_error("Cannot make an illegal move");
     }
 
-    fieldTo->setState(fieldFrom->getState());
-
-    // checks if pawns should be duplicated
-    // checks horizontal
-    if (fieldFrom->getRow() == fieldTo->getRow())
-        fieldFrom->setState(Empty);
-    // checks vertical
-    if (fieldFrom->getUiColumn() == fieldTo->getUiColumn() && abs(fieldFrom->getRow() - fieldTo->getRow()) == 4)
-        fieldFrom->setState(Empty);
-    // checks diagonals
-    if (abs(fieldFrom->getRow() - fieldTo->getRow()) == 3)
-        fieldFrom->setState(Empty);
-    if (abs(fieldFrom->getRow() - fieldTo->getRow()) == 2 &&
-        abs(fieldFrom->getUiColumn() - fieldTo->getUiColumn()) == 2)
-        fieldFrom->setState(Empty);
-
-    runMoveSideEffects(side, fieldTo);
+    return makeMoveUnchecked(
+            side,
+            Bitboards::cellIndex(static_cast<short>(move.from.row), static_cast<short>(move.from.uiColumn)),
+            Bitboards::cellIndex(static_cast<short>(move.to.row), static_cast<short>(move.to.uiColumn)));
 }
 
-void Board::runMoveSideEffects(Side side, Field *field) const {
-    FieldState enemyFieldState = side == Side::RedSide ? FieldState::Blue : FieldState::Red;
-    FieldState desiredFieldState = field->getState();
+UndoRecord Board::makeMoveUnchecked(Side side, short from, short to) {
+    setCellState(to, Team::sideToFieldStatus(side));
 
-    std::vector<Field *> fieldsAround = findFieldsAround(field, true);
+    // pawn is duplicated when moved to a bordering field, otherwise it is relocated
+    if ((Bitboards::borderingCells(from) & Bitboards::cellMask(to)) == 0)
+        setCellState(from, Empty);
 
-    std::for_each(fieldsAround.begin(), fieldsAround.end(), [enemyFieldState, desiredFieldState](Field *field) {
-        if (field->getState() == enemyFieldState) field->setState(desiredFieldState);
-    });
+    return {side, from, to, captureCellsAround(side, to)};
 }
 
-std::vector<Field *> Board::findFieldsAround(Field *field, bool isBordering) const {
-    std::vector<Field *> fieldsAround;
+void Board::unmakeMove(const UndoRecord &record) {
+    FieldState enemyFieldState = Team::sideToFieldStatus(Team::oppositeSide(record.side));
 
-    if (isBordering) {
-        short borderingRowModifiers[6] = {-1, -1, -2, 1, 1, 2};
-        short borderingUiColumnModifiers[6] = {-1, 1, 0, -1, 1, 0};
+    for (Bitboard convertedCells = record.convertedCells; convertedCells != 0;)
+        setCellState(Bitboards::popLowestCell(convertedCells), enemyFieldState);
 
-        for (unsigned short i = 0; i < 6; i++) {
-            std::optional<Field *> optionalField = getFieldByMoveUnit(
-                    MoveUnit(
-                            field->getRow() + borderingRowModifiers[i],
-                            field->getUiColumn() + borderingUiColumnModifiers[i]));
+    setCellState(record.to, Empty);
 
-            if (optionalField.has_value()) {
-                fieldsAround.emplace_back(optionalField.value());
-            }
-        }
+    if ((Bitboards::borderingCells(record.from) & Bitboards::cellMask(record.to)) == 0)
+        setCellState(record.from, Team::sideToFieldStatus(record.side));
+}
 
-        return fieldsAround;
-    }
+void Board::runMoveSideEffects(Side side, const Field *field) {
+    captureCellsAround(side, Bitboards::cellIndexByColumn(
+            static_cast<short>(field->getRow()),
+            static_cast<short>(field->getColumn())));
+}
 
-    short nonBorderingRowModifiers[12] = {-4, -3, -2, 0, 2, 3, 4, 3, 2, 0, -2, -3};
-    short nonBorderingUiColumnModifiers[12] = {0, 1, 2, 2, 2, 1, 0, -1, -2, -2, -2, -1};
+Bitboard Board::captureCellsAround(Side side, short cellIndex) {
+    FieldState desiredFieldState = getFieldByCellIndex(cellIndex)->getState();
+    Bitboard capturedCells = Bitboards::borderingCells(cellIndex) & getSideCells(side == RedSide ? BlueSide : RedSide);
 
-    for (unsigned short i = 0; i < 12; i++) {
-        std::optional<Field *> optionalField = getFieldByMoveUnit(
-                MoveUnit(
-                        field->getRow() + nonBorderingRowModifiers[i],
-                        field->getUiColumn() + nonBorderingUiColumnModifiers[i]));
+    for (Bitboard cellsToCapture = capturedCells; cellsToCapture != 0;)
+        setCellState(Bitboards::popLowestCell(cellsToCapture), desiredFieldState);
 
-        if (optionalField.has_value()) {
-            fieldsAround.emplace_back(optionalField.value());
-        }
-    }
+    return capturedCells;
+}
+
+std::vector<const Field *> Board::findFieldsAround(const Field *field, bool isBordering) const {
+    short cellIndex = Bitboards::cellIndexByColumn(
+            static_cast<short>(field->getRow()),
+            static_cast<short>(field->getColumn()));
+    const CellList &cellsAround = isBordering
+                                  ? Bitboards::borderingCellsList(cellIndex)
+                                  : Bitboards::nonBorderingCellsList(cellIndex);
+
+    std::vector<const Field *> fieldsAround;
+    fieldsAround.reserve(cellsAround.size);
+
+    for (short aroundCellIndex: cellsAround) fieldsAround.emplace_back(getFieldByCellIndex(aroundCellIndex));
 
     return fieldsAround;
 }
 
-std::optional<Field *> Board::getFieldByMoveUnit(MoveUnit moveUnit) const {
-    if (moveUnit.row < 0 || moveUnit.row >= BOARD_ROWS_COUNT || moveUnit.uiColumn < 0 ||
-        moveUnit.uiColumn >= BOARD_COLUMNS_COUNT)
-        return std::nullopt;
-
-    auto it = std::find_if(
-            this->fields[moveUnit.row].begin(),
-            this->fields[moveUnit.row].end(),
-            [moveUnit](Field *field) -> bool {
-                return field->getUiColumn() == moveUnit.uiColumn;
-            });
+std::optional<const Field *> Board::getFieldByMoveUnit(MoveUnit moveUnit) const {
+    short cellIndex = Bitboards::cellIndex(static_cast<short>(moveUnit.row), static_cast<short>(moveUnit.uiColumn));
 
-    if (it == fields[moveUnit.row].end()) return std::nullopt;
-    else return this->fields[moveUnit.row][std::distance(this->fields[moveUnit.row].begin(), it)];
+    if (cellIndex == NO_CELL) return std::nullopt;
+    else return &this->cells[cellIndex];
 }
 
 Points Board::getPoints() const {
-    unsigned short red = 0;
-    unsigned short blue = 0;
-
-    for (short row = 0; row < BOARD_ROWS_COUNT; row++) {
-        std::for_each(this->fields[row].begin(), this->fields[row].end(), [&red, &blue](Field *field) {
-            if (field->getState() == Red) red++;
-            if (field->getState() == Blue) blue++;
-        });
-    }
-
-    return {red, blue};
+    return {this->stateCounts[Red], this->stateCounts[Blue]};
 }
 
-std::vector<MoveWithBorderingStatus> Board::findLegalMoves(Side side, std::optional<Field *> field) const {
-    // find all side fields
-    std::vector<Field *> allSideFields;
-    FieldState desiredFieldState = Team::sideToFieldStatus(side);
+std::vector<MoveWithBorderingStatus> Board::findLegalMoves(Side side, std::optional<const Field *> field) const {
+    Bitboard sideCells = getSideCells(side);
+    Bitboard emptyCells = getEmptyCells();
 
+    // if the field is provided, it is the only field from which moves can be made
     if (field.has_value())
-        allSideFields.emplace_back(field.value());
-    else
-        for (short row = 0; row < BOARD_ROWS_COUNT; row++) {
-            std::for_each(this->fields[row].begin(), this->fields[row].end(),
-                          [desiredFieldState, &allSideFields](Field *field) {
-                              if (field->getState() == desiredFieldState) allSideFields.emplace_back(field);
-                          });
-        }
+        sideCells &= Bitboards::cellMask(Bitboards::cellIndexByColumn(
+                static_cast<short>(field.value()->getRow()),
+                static_cast<short>(field.value()->getColumn())));
 
     // find all possible moves, categorize which are bordering the original field
     std::vector<MoveWithBorderingStatus> legalMoves;
 
-    std::for_each(allSideFields.begin(), allSideFields.end(),
-                  [this, &legalMoves, side](Field *field) {
-                      MoveUnit fromMoveUnit(field->getRow(), field->getUiColumn());
-
-                      // runs once for fields bordering the original field, and once for those which do not border
-                      for (short i = 0; i < 2; i++) {
-                          bool isBordering = i == 0;
-
-                          std::vector<Field *> aroundFields = findFieldsAround(field, isBordering);
-
-                          // of all the fields around the original field find those that are Empty
-                          // and can be used to construct a legal move
-                          std::for_each(aroundFields.begin(), aroundFields.end(),
-                                        [this, &legalMoves, fromMoveUnit, side, isBordering](Field *aroundField) {
-                                            MoveUnit toMoveUnit = MoveUnit(aroundField->getRow(),
-                                                                           aroundField->getUiColumn());
-                                            if (aroundField->getState() == Empty &&
-                                                isMoveLegal(side, Move(fromMoveUnit, toMoveUnit)))
-                                                legalMoves.emplace_back(MoveWithBorderingStatus(
-                                                        fromMoveUnit,
-                                                        toMoveUnit,
-                                                        isBordering
-                                                ));
-                                        });
-                      }
-                  });
+    while (sideCells != 0) {
+        short sideCellIndex = Bitboards::popLowestCell(sideCells);
+        MoveUnit fromMoveUnit(Bitboards::cellRow(sideCellIndex), Bitboards::cellUiColumn(sideCellIndex));
+
+        // runs once for fields bordering the original field, and once for those which do not border
+        for (short i = 0; i < 2; i++) {
+            bool isBordering = i == 0;
+            const CellList &cellsAround = isBordering
+                                          ? Bitboards::borderingCellsList(sideCellIndex)
+                                          : Bitboards::nonBorderingCellsList(sideCellIndex);
+
+            // fields around are always in a legal distance, so the move is legal as long as the field is Empty
+            for (short aroundCellIndex: cellsAround) {
+                if ((emptyCells & Bitboards::cellMask(aroundCellIndex)) == 0) continue;
+
+                legalMoves.emplace_back(MoveWithBorderingStatus(
+                        fromMoveUnit,
+                        MoveUnit(Bitboards::cellRow(aroundCellIndex), Bitboards::cellUiColumn(aroundCellIndex)),
+                        isBordering
+                ));
+            }
+        }
+    }
 
     return legalMoves;
 }
 
+short Board::generateMoves(Side side, MoveBuffer &moves) const {
+    Bitboard sideCells = getSideCells(side);
+    Bitboard emptyCells = getEmptyCells();
+    Bitboard cloneTargets = 0;
+    short count = 0;
 
-std::optional<Move> Board::findBestMove(Side side) const {
-    std::vector<MoveWithBorderingStatus> legalMoves = findLegalMoves(side, std::nullopt);
+    for (Bitboard cells = sideCells; cells != 0;)
+        cloneTargets |= Bitboards::borderingCells(Bitboards::popLowestCell(cells)) & emptyCells;
+
+    // every field is cloned to from the lowest of the side's fields bordering it
+    while (cloneTargets != 0) {
+        short to = Bitboards::popLowestCell(cloneTargets);
+        Bitboard sources = Bitboards::borderingCells(to) & sideCells;
+        moves[count++] = CellMove(Bitboards::popLowestCell(sources), to);
+    }
 
-    FieldState enemyFieldState = side == RedSide ? Blue : Red;
+    for (Bitboard cells = sideCells; cells != 0;) {
+        short from = Bitboards::popLowestCell(cells);
 
-    if (legalMoves.empty()) return std::nullopt;
+        for (Bitboard targets = Bitboards::nonBorderingCells(from) & emptyCells; targets != 0;)
+            moves[count++] = CellMove(from, Bitboards::popLowestCell(targets));
+    }
+
+    return count;
+}
+
+std::optional<Move> Board::findBestMove(Side side) const {
+    Bitboard sideCells = getSideCells(side);
+    Bitboard emptyCells = getEmptyCells();
+
+    // enemy fields captured by a move depend only on the field to which it is made, so they are counted
+    // for all the fields at once
+    BorderingCounts capturesCounts;
+    CaptureCounter::countBorderingCells(getSideCells(Team::oppositeSide(side)), capturesCounts);
+
+    // the most points which can be gained are found for all the moves at once, a clone move to a field gains
+    // a point more than a jump to it, and every captured field gains two points as the enemy loses one
+    Bitboard cloneTargets = 0;
+    Bitboard jumpTargets = 0;
+
+    for (Bitboard cells = sideCells; cells != 0;) {
+        short from = Bitboards::popLowestCell(cells);
+        cloneTargets |= Bitboards::borderingCells(from);
+        jumpTargets |= Bitboards::nonBorderingCells(from);
+    }
 
-    // calculate points for each move and save the best one
-    short bestMovePoints = 0;
-    Move bestMove = legalMoves[0];
+    short bestMovePoints = -1;
 
-    std::for_each(legalMoves.begin(), legalMoves.end(),
-                  [this, enemyFieldState, &bestMovePoints, &bestMove](MoveWithBorderingStatus move) {
-                      short points = 0;
+    for (Bitboard targets = cloneTargets & emptyCells; targets != 0;) {
+        short to = Bitboards::popLowestCell(targets);
+        bestMovePoints = std::max(bestMovePoints, static_cast<short>(2 * capturesCounts[to] + 1));
+    }
+    for (Bitboard targets = jumpTargets & emptyCells; targets != 0;) {
+        short to = Bitboards::popLowestCell(targets);
+        bestMovePoints = std::max(bestMovePoints, static_cast<short>(2 * capturesCounts[to]));
+    }
 
-                      if (move.isBordering) points++;
+    if (bestMovePoints < 0) return std::nullopt;
 
-                      Field *to = this->getFieldByMoveUnit(move.to).value();
-                      std::vector<Field *> fieldsAround = this->findFieldsAround(to, true);
+    // moves are checked in the order of findLegalMoves, and the first one gaining the most points is picked
+    short bestFrom = NO_CELL;
+    short bestTo = NO_CELL;
 
-                      std::for_each(fieldsAround.begin(), fieldsAround.end(),
-                                    [enemyFieldState, &points](Field *field) {
-                                        if (field->getState() == enemyFieldState) {
-                                            // double points because enemy loses one point
-                                            points += 2;
-                                        }
-                                    });
+    while (sideCells != 0 && bestFrom == NO_CELL) {
+        short from = Bitboards::popLowestCell(sideCells);
 
-                      if (points > bestMovePoints) {
-                          bestMovePoints = points;
-                          bestMove = move;
-                      }
-                  });
+        for (short i = 0; i < 2 && bestFrom == NO_CELL; i++) {
+            bool isBordering = i == 0;
+            const CellList &cellsAround = isBordering
+                                          ? Bitboards::borderingCellsList(from)
+                                          : Bitboards::nonBorderingCellsList(from);
 
-    return bestMove;
-}
+            for (short to: cellsAround) {
+                if ((emptyCells & Bitboards::cellMask(to)) == 0) continue;
 
-void Board::fillBoardWithState(FieldState state) const {
-    for (int i = 0; i < this->fields.size(); i++) {
-        for (auto it = fields[i].begin(); it < fields[i].end(); it++) {
-            if ((*it)->getState() != state && (*it)->getState() != Blocked) {
-                (*it)->setState(state);
+                if (2 * capturesCounts[to] + (isBordering ? 1 : 0) == bestMovePoints) {
+                    bestFrom = from;
+                    bestTo = to;
+                    break;
+                }
             }
         }
     }
+
+    return Move(MoveUnit(Bitboards::cellRow(bestFrom), Bitboards::cellUiColumn(bestFrom)),
+                MoveUnit(Bitboards::cellRow(bestTo), Bitboards::cellUiColumn(bestTo)));
+}
+
+void Board::fillBoardWithState(FieldState state) {
+    Bitboard cellsToFill = Bitboards::ALL_CELLS & ~this->blockedCells;
+
+    while (cellsToFill != 0) {
+        short cellIndex = Bitboards::popLowestCell(cellsToFill);
+        if (getFieldByCellIndex(cellIndex)->getState() != state) setCellState(cellIndex, state);
+    }
+}
+
+void Board::fillBoardIfSideEliminated() {
+    if (this->redCells == 0) fillBoardWithState(Blue);
+    else if (this->blueCells == 0) fillBoardWithState(Red);
 }
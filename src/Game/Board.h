@@ -3,45 +3,168 @@
 
 #include <algorithm>
 #include <optional>
+#include <span>
 #include "Field.h"
 #include "Team.h"
 #include "../Consts.h"
 #include "Points.h"
 #include "Move.h"
+#include "Bitboard.h"
+#include "Symmetry.h"
+#include "Zobrist.h"
 
 namespace Game {
     // blocked fields always need to be the same
-    const std::vector<Field *> REQUIRED_INITIAL_FIELDS = {
-            new Game::Field(Blocked, 6, 2),
-            new Game::Field(Blocked, 9, 1),
-            new Game::Field(Blocked, 9, 2),
+    const std::vector<Field> REQUIRED_INITIAL_FIELDS = {
+            Field(Blocked, 6, 2),
+            Field(Blocked, 9, 1),
+            Field(Blocked, 9, 2),
     };
 
     // pawns positions at the start of the game
-    const std::vector<Field *> INITIAL_FIELDS = {
-            new Game::Field(Red, 4, 0),
-            new Game::Field(Red, 4, 4),
-            new Game::Field(Red, 16, 0),
-            new Game::Field(Blue, 0, 0),
-            new Game::Field(Blue, 12, 0),
-            new Game::Field(Blue, 12, 4),
+    const std::vector<Field> INITIAL_FIELDS = {
+            Field(Red, 4, 0),
+            Field(Red, 4, 4),
+            Field(Red, 16, 0),
+            Field(Blue, 0, 0),
+            Field(Blue, 12, 0),
+            Field(Blue, 12, 4),
     };
 
+    /**
+     * Everything needed for reverting a move made on a board
+     */
+    class UndoRecord {
+    public:
+        Side side;
+        // index of the field from which the pawn was moved
+        short from;
+        // index of the field to which the pawn was moved
+        short to;
+        // enemy fields converted by the move
+        Bitboard convertedCells;
+
+        UndoRecord() = default;
+
+        UndoRecord(Side side, short from, short to, Bitboard convertedCells);
+    };
+
+    /**
+     * Board owns all of its fields, so copying a board creates a fully independent board, without any allocations
+     */
     class Board {
-        std::array<std::vector<Field *>, BOARD_ROWS_COUNT> fields;
+        // fields indexed with the cell indexes, so the fields of every row are placed next to each other
+        std::array<Field, BOARD_CELLS_COUNT> cells;
+        // states of the fields kept as bitboards, always in sync with the \p cells
+        Bitboard redCells = 0;
+        Bitboard blueCells = 0;
+        Bitboard blockedCells = 0;
+        // Zobrist hashes of the fields' states, updated with every change of a field. Indexed with the \p Symmetry
+        // values, every one is the hash of the board transformed by that symmetry
+        std::array<std::uint64_t, SYMMETRIES_COUNT> hashes{};
+        // counts of the fields in every state, indexed with the \p FieldState values
+        std::array<unsigned short, 4> stateCounts{};
+        // whether each side can make any move, indexed with the \p Side values, negative when not known yet.
+        // Filled lazily by the const \p hasLegalMove, so it is accessed atomically in case a board is shared
+        // between threads
+        mutable std::array<signed char, 2> legalMoveCache{-1, -1};
     private:
+        /**
+         * The only place where states of the fields get changed, keeps the bitboards and the hashes in sync
+         * with the fields
+         */
+        void setCellState(short cellIndex, FieldState state);
+
+        const Field *getFieldByCellIndex(short cellIndex) const;
+
+        /**
+         * Changes the states of the enemy fields bordering the field to the state of the \p side
+         * @return Fields which had their state changed
+         */
+        Bitboard captureCellsAround(Side side, short cellIndex);
+
     public:
+        /**
+         * Creates a board in the initial position, copied from \p getInitialPosition
+         */
+        Board();
+
         /**
          * Creates a board initialized with \p initialFields, and then with \p REQUIRED_INITIAL_FIELDS.
-         * All the other fields are filled with empty fields.
-         * @param initialFields If not provided, defaults to \p INITIAL_FIELDS
+         * All the other fields are filled with empty fields. Passed fields are copied, so they are never
+         * modified by the board.
          */
-        explicit Board(const std::vector<Field *> &initialFields = INITIAL_FIELDS);
+        explicit Board(const std::vector<Field> &initialFields);
 
-        std::array<std::vector<Field *>, BOARD_ROWS_COUNT> getFields() const;
+        /**
+         * Board is a value type, so every board created from the initial position is independent of the others
+         * and of this one
+         * @return Board created from \p INITIAL_FIELDS once, on the first call
+         */
+        static const Board &getInitialPosition();
+
+        /**
+         * Creates a board out of the bitboards of the pawns, blocked fields are always the ones from
+         * \p REQUIRED_INITIAL_FIELDS
+         * @throws std::invalid_argument If the bitboards overlap each other or the blocked fields,
+         * or contain fields outside the board
+         */
+        static Board fromBitboards(Bitboard redCells, Bitboard blueCells);
+
+        /**
+         * Fields are viewed without being copied, so the view is valid only as long as the board exists
+         * @return Fields of the \p row, from left to right
+         */
+        std::span<const Field> getRow(short row) const;
+
+        /**
+         * @return View of all the fields indexed with the cell indexes, so they are ordered row by row
+         */
+        std::span<const Field, BOARD_CELLS_COUNT> getCells() const;
+
+        /**
+         * @return State of the field with the \p cellIndex, cheaper than reading the whole field
+         */
+        FieldState getCellState(short cellIndex) const;
 
         bool isGameFinished() const;
 
+        /**
+         * @return Zobrist hash of the fields' states, it does not include the side making a move
+         */
+        std::uint64_t getHash() const;
+
+        /**
+         * Equivalent positions, see \p Symmetry, get the same key, so they can share the entries of the hash
+         * tables and files. Moves saved under the key have to be transformed with the returned symmetry.
+         * @return Key of the position together with the \p side making a move
+         */
+        CanonicalKey getCanonicalKey(Side side) const;
+
+        /**
+         * @return Copy of the board with the \p symmetry applied to all the pawns
+         */
+        Board transformed(Symmetry symmetry) const;
+
+        /**
+         * @return Bitboard of the fields taken by the \p side
+         */
+        Bitboard getSideCells(Side side) const;
+
+        /**
+         * @return Bitboard of the empty fields, blocked ones are not included
+         */
+        Bitboard getEmptyCells() const;
+
+        Bitboard getBlockedCells() const;
+
+        /**
+         * Cheaper than checking if \p findLegalMoves returns any moves, the result is cached until the board
+         * changes
+         * @return True if the \p side can make any move, otherwise it has to skip its turn
+         */
+        bool hasLegalMove(Side side) const;
+
         /**
          * @return True if a \p move can be made by the provided \p side
          */
@@ -51,15 +174,31 @@ namespace Game {
          * Handles a move and all other events that should take place when the move is made
          * @param side Side making a move
          * @param move Passing an illegal move will result in an exception being thrown
+         * @return Record which can be passed to \p unmakeMove in order to revert the move
+         */
+        UndoRecord makeMove(Side side, Move move);
+
+        /**
+         * Works the same as \p makeMove, but without checking if the move is legal, so it should only be used for
+         * moves which are already known to be legal, e.g. the ones returned by \p findLegalMoves
+         * @param from Index of the field from which the pawn is moved
+         * @param to Index of the field to which the pawn is moved
          */
-        void makeMove(Side side, Move move) const;
+        UndoRecord makeMoveUnchecked(Side side, short from, short to);
+
+        /**
+         * Restores the state of the board from before the move, when multiple moves were made they have to be
+         * reverted in the reverse order
+         * @param record Record returned when the move was made
+         */
+        void unmakeMove(const UndoRecord &record);
 
         /**
          * Handles changing the states of fields around the provided \p field
          * @param side Side making a move
          * @param field Field to which the pawn will be moved
          */
-        void runMoveSideEffects(Side side, Field *field) const;
+        void runMoveSideEffects(Side side, const Field *field);
 
         /**
          * @param field Field to be checked
@@ -67,12 +206,12 @@ namespace Game {
          * or one field away from it
          * @return Vector of pointers to fields which can be found around the provided \p field
          */
-        std::vector<Field *> findFieldsAround(Field *field, bool isBordering) const;
+        std::vector<const Field *> findFieldsAround(const Field *field, bool isBordering) const;
 
         /**
          * @return Returns a field pointed to by the \p moveUnit, if one can be found
          */
-        std::optional<Field *> getFieldByMoveUnit(MoveUnit moveUnit) const;
+        std::optional<const Field *> getFieldByMoveUnit(MoveUnit moveUnit) const;
 
         Points getPoints() const;
 
@@ -81,7 +220,16 @@ namespace Game {
          * @param field If provided, legal moves returned will be these that can be done from that \p field
          * @return Vector of moves that can be made
          */
-        std::vector<MoveWithBorderingStatus> findLegalMoves(Side side, std::optional<Field *> field) const;
+        std::vector<MoveWithBorderingStatus> findLegalMoves(Side side, std::optional<const Field *> field) const;
+
+        /**
+         * Faster alternative of \p findLegalMoves for the engines, moves are made straight out of the bitboards
+         * and written to the caller's buffer. Clone moves to the same field lead to the same position, so only
+         * one of them is generated, and all the clone moves are placed before the jumps.
+         * @param moves Buffer filled with the moves of the \p side
+         * @return Count of the generated moves
+         */
+        short generateMoves(Side side, MoveBuffer &moves) const;
 
         /**
          * @param side Side making a move
@@ -93,7 +241,13 @@ namespace Game {
         /**
          * Won't affect Blocked fields
          */
-        void fillBoardWithState(FieldState state) const;
+        void fillBoardWithState(FieldState state);
+
+        /**
+         * It is possible that one of the teams loses all the pawns when there are still empty fields, there is
+         * no sense in continuing a game like that, so all the fields are given to the other team
+         */
+        void fillBoardIfSideEliminated();
     };
 }
 
@@ -0,0 +1,120 @@
+#include "CaptureCounter.h"
+
+// the vectorized implementations are compiled for their instruction sets with the target attributes,
+// so the rest of the program still runs on any x86-64 processor
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PJC_HEXAGON_X86_DISPATCH
+
+#include <immintrin.h>
+#endif
+
+using namespace Game;
+
+namespace {
+    // masks of the fields bordering every field, fields past the end of the board border nothing
+    alignas(32) constexpr std::array<Bitboard, 64> BORDERING_MASKS = [] {
+        std::array<Bitboard, 64> masks{};
+        for (short cellIndex = 0; cellIndex < BOARD_CELLS_COUNT; cellIndex++)
+            masks[cellIndex] = Bitboards::borderingCells(cellIndex);
+        return masks;
+    }();
+
+    // same masks ordered for the AVX2 implementation, the lane j of the k-th vector holds the mask of the field
+    // with the index 16 * j + k, so the counts of the neighbouring fields end up in the neighbouring bytes of a lane
+    alignas(32) constexpr std::array<Bitboard, 64> INTERLEAVED_BORDERING_MASKS = [] {
+        std::array<Bitboard, 64> masks{};
+        for (short vector = 0; vector < 16; vector++) {
+            for (short lane = 0; lane < 4; lane++) masks[vector * 4 + lane] = BORDERING_MASKS[lane * 16 + vector];
+        }
+        return masks;
+    }();
+}
+
+void CaptureCounter::countBorderingCells(Bitboard cells, BorderingCounts &counts) {
+    // selected once, initialization of a static local variable is thread safe
+    static const Implementation implementation = selectImplementation().second;
+
+    implementation(cells, counts);
+}
+
+const char *CaptureCounter::getImplementationName() {
+    return selectImplementation().first;
+}
+
+std::vector<std::pair<const char *, CaptureCounter::Implementation>> CaptureCounter::getSupportedImplementations() {
+    std::vector<std::pair<const char *, Implementation>> implementations = {{"scalar", countScalar}};
+
+#ifdef PJC_HEXAGON_X86_DISPATCH
+    if (__builtin_cpu_supports("popcnt")) implementations.emplace_back("popcnt", countPopcnt);
+    if (__builtin_cpu_supports("avx2")) implementations.emplace_back("avx2", countAvx2);
+#endif
+
+    return implementations;
+}
+
+const std::pair<const char *, CaptureCounter::Implementation> &CaptureCounter::selectImplementation() {
+    static const std::pair<const char *, Implementation> implementation = getSupportedImplementations().back();
+
+    return implementation;
+}
+
+void CaptureCounter::countScalar(Bitboard cells, BorderingCounts &counts) {
+    for (short cellIndex = 0; cellIndex < 64; cellIndex++)
+        counts[cellIndex] = static_cast<unsigned char>(Bitboards::count(BORDERING_MASKS[cellIndex] & cells));
+}
+
+#ifdef PJC_HEXAGON_X86_DISPATCH
+
+__attribute__((target("popcnt")))
+void CaptureCounter::countPopcnt(Bitboard cells, BorderingCounts &counts) {
+    for (short cellIndex = 0; cellIndex < 64; cellIndex++)
+        counts[cellIndex] = static_cast<unsigned char>(__builtin_popcountll(BORDERING_MASKS[cellIndex] & cells));
+}
+
+__attribute__((target("avx2")))
+void CaptureCounter::countAvx2(Bitboard cells, BorderingCounts &counts) {
+    // bits of every byte are counted by looking up both of its halves in a table of the counts of bits in 4-bit
+    // numbers, and the counts of the bytes are then summed per 64-bit lane
+    const __m256i bitsCounts = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowHalves = _mm256_set1_epi8(0x0f);
+    const __m256i countedCells = _mm256_set1_epi64x(static_cast<long long>(cells));
+    // every count fits in a byte, the counts of the vectors 0-7 and 8-15 are gathered in the bytes of the two
+    // following vectors
+    __m256i firstCounts = _mm256_setzero_si256();
+    __m256i secondCounts = _mm256_setzero_si256();
+
+    for (short vector = 0; vector < 16; vector++) {
+        __m256i masks = _mm256_and_si256(
+                _mm256_load_si256(reinterpret_cast<const __m256i *>(&INTERLEAVED_BORDERING_MASKS[vector * 4])),
+                countedCells);
+        __m256i lowCounts = _mm256_shuffle_epi8(bitsCounts, _mm256_and_si256(masks, lowHalves));
+        __m256i highCounts = _mm256_shuffle_epi8(bitsCounts, _mm256_and_si256(_mm256_srli_epi16(masks, 4), lowHalves));
+        __m256i sums = _mm256_sad_epu8(_mm256_add_epi8(lowCounts, highCounts), _mm256_setzero_si256());
+
+        __m256i shiftedSums = _mm256_sll_epi64(sums, _mm_cvtsi32_si128((vector % 8) * 8));
+        if (vector < 8) firstCounts = _mm256_or_si256(firstCounts, shiftedSums);
+        else secondCounts = _mm256_or_si256(secondCounts, shiftedSums);
+    }
+
+    // lane j of the first vector holds the fields 16 * j to 16 * j + 7, and of the second one the next 8 fields
+    __m256i lowLanes = _mm256_unpacklo_epi64(firstCounts, secondCounts);
+    __m256i highLanes = _mm256_unpackhi_epi64(firstCounts, secondCounts);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(counts.data()),
+                        _mm256_permute2x128_si256(lowLanes, highLanes, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(counts.data() + 32),
+                        _mm256_permute2x128_si256(lowLanes, highLanes, 0x31));
+}
+
+#else
+
+void CaptureCounter::countPopcnt(Bitboard cells, BorderingCounts &counts) {
+    countScalar(cells, counts);
+}
+
+void CaptureCounter::countAvx2(Bitboard cells, BorderingCounts &counts) {
+    countScalar(cells, counts);
+}
+
+#endif
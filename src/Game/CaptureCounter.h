@@ -0,0 +1,53 @@
+#ifndef PJC_HEXAGON_CAPTURECOUNTER_H
+#define PJC_HEXAGON_CAPTURECOUNTER_H
+
+#include <array>
+#include <utility>
+#include <vector>
+#include "Bitboard.h"
+
+namespace Game {
+    // count of the passed cells bordering each field, indexed with the cell indexes and padded to the bitboard size
+    typedef std::array<unsigned char, 64> BorderingCounts;
+
+    /**
+     * Counts the fields bordering every field of the board at once, used for scoring all the moves of the greedy
+     * player together. The fastest implementation supported by the processor is picked on the first call:
+     * AVX2, which counts four fields per instruction, the hardware popcnt instruction, or a portable fallback.
+     */
+    class CaptureCounter {
+    public:
+        typedef void (*Implementation)(Bitboard cells, BorderingCounts &counts);
+
+        /**
+         * @param cells Fields to be counted, e.g. the enemy's fields which would be captured by a move to a field
+         * @param counts Filled with the count of the \p cells bordering every field
+         */
+        static void countBorderingCells(Bitboard cells, BorderingCounts &counts);
+
+        /**
+         * @return Name of the implementation used by \p countBorderingCells
+         */
+        static const char *getImplementationName();
+
+        /**
+         * Implementations are exposed for the benchmarks, only the ones supported by the processor can be called
+         * @return All the implementations supported by the processor, the portable one first
+         */
+        static std::vector<std::pair<const char *, Implementation>> getSupportedImplementations();
+
+    private:
+        static void countScalar(Bitboard cells, BorderingCounts &counts);
+
+        static void countPopcnt(Bitboard cells, BorderingCounts &counts);
+
+        static void countAvx2(Bitboard cells, BorderingCounts &counts);
+
+        /**
+         * @return The fastest implementation supported by the processor, with its name
+         */
+        static const std::pair<const char *, Implementation> &selectImplementation();
+    };
+}
+
+#endif //PJC_HEXAGON_CAPTURECOUNTER_H
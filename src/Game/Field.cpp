@@ -8,9 +8,7 @@ Field::Field(FieldState state, unsigned short row, unsigned short column) {
     this->row = row;
     this->column = column;
 
-    short columns = columnsInRowByRowIndex(row);
-    short sideEmptyColumns = (BOARD_COLUMNS_COUNT - (columns * 2 - 1)) / 2;
-    this->uiColumn = (sideEmptyColumns + column * 2);
+    this->uiColumn = uiColumnByColumn(static_cast<short>(column), static_cast<short>(row));
 }
 
 void Field::setState(FieldState _state) {
@@ -51,17 +49,3 @@ bool Field::isColumnInRowValid(short column, short row) {
 bool Field::isUiColumnValid(short uiColumn) {
     return uiColumn >= 0 && uiColumn < BOARD_COLUMNS_COUNT;
 }
-
-short Field::columnsInRowByRowIndex(short row) {
-    short columns;
-
-    // may not work correctly if BOARD_ROWS_COUNT is changed,
-    // but for the purpose of this game there is no need to handle that
-    if (row == 0 || row == BOARD_ROWS_COUNT - 1) columns = 1;
-    else if (row == 1 || row == BOARD_ROWS_COUNT - 2) columns = 2;
-    else if (row == 2 || row == BOARD_ROWS_COUNT - 3) columns = 3;
-        // all the other columns have alternating values of 4 and 5
-    else columns = 5 - (row % 2);
-
-    return columns;
-}
@@ -42,7 +42,24 @@ namespace Game {
         /**
          * @return Count of fields in the row, does not take into account empty spaces indexed with uiColumn
          */
-        static short columnsInRowByRowIndex(short row);
+        static constexpr short columnsInRowByRowIndex(short row) {
+            // may not work correctly if BOARD_ROWS_COUNT is changed,
+            // but for the purpose of this game there is no need to handle that
+            if (row == 0 || row == BOARD_ROWS_COUNT - 1) return 1;
+            if (row == 1 || row == BOARD_ROWS_COUNT - 2) return 2;
+            if (row == 2 || row == BOARD_ROWS_COUNT - 3) return 3;
+            // all the other columns have alternating values of 4 and 5
+            return static_cast<short>(5 - (row % 2));
+        }
+
+        /**
+         * @return uiColumn of the field placed in the \p column of the \p row
+         */
+        static constexpr short uiColumnByColumn(short column, short row) {
+            short columns = columnsInRowByRowIndex(row);
+            auto sideEmptyColumns = static_cast<short>((BOARD_COLUMNS_COUNT - (columns * 2 - 1)) / 2);
+            return static_cast<short>(sideEmptyColumns + column * 2);
+        }
     };
 }
 
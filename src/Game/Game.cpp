@@ -1,12 +1,31 @@
 #include "Game.h"
-
-Game::Game::Game(UI::UI *ui) : Game() {
-    this->ui = ui;
+#include "../AI/BookEngine.h"
+#include "../AI/EndgameSolver.h"
+#include "../AI/MctsEngine.h"
+#include "../AI/SearchEngine.h"
+
+Game::Game::Game(std::unique_ptr<UI::UI> ui) : Game(
+        std::move(ui),
+        // endings are solved exactly, the rest of the game is searched, the tables and the nodes pool are kept
+        // small as the engines are created even when no computer team plays
+        std::make_unique<AI::EndgameSolver>(
+                std::make_unique<AI::SearchEngine>(AI::SearchLimits(4, std::chrono::seconds(1), 0), nullptr,
+                                                   std::make_shared<AI::TranspositionTable>(4)),
+                AI::ENDGAME_EMPTY_CELLS_THRESHOLD, std::chrono::seconds(1), 4),
+        std::make_unique<AI::MctsEngine>(AI::MctsLimits(0, std::chrono::seconds(1)), 1 << 16)) {}
+
+Game::Game::Game(
+        std::unique_ptr<UI::UI> ui,
+        std::unique_ptr<AI::Engine> computerEngine,
+        std::unique_ptr<AI::Engine> mctsEngine) : Game() {
+    this->ui = std::move(ui);
+    this->computerEngine = std::move(computerEngine);
+    this->mctsEngine = std::move(mctsEngine);
 }
 
 std::optional<FileManagement::DeserializedGame> Game::Game::initializeTeams() {
     do {
-        std::optional<Teams *> uiTeams = this->ui->getTeams();
+        std::optional<Teams> uiTeams = this->ui->getTeams();
 
         if (uiTeams.has_value()) {
             this->teams = uiTeams.value();
@@ -20,60 +39,70 @@ std::optional<FileManagement::DeserializedGame> Game::Game::initializeTeams() {
 }
 
 void Game::Game::startGame() {
-    this->board = new Board();
+    this->board = Board();
     this->startGameLoop(Side::RedSide);
 }
 
-void Game::Game::startGame(Teams *_teams, Side startingSide, Board *_board) {
+void Game::Game::startGame(const Teams &_teams, Side startingSide, const Board &_board) {
     this->teams = _teams;
     this->board = _board;
     this->startGameLoop(startingSide);
 }
 
+void Game::Game::setMoveLog(std::unique_ptr<FileManagement::MoveLogWriter> _moveLog) {
+    this->moveLog = std::move(_moveLog);
+}
+
+void Game::Game::setOpeningBook(std::shared_ptr<const FileManagement::OpeningBook> book) {
+    this->computerEngine = std::make_unique<AI::BookEngine>(std::move(book), std::move(this->computerEngine));
+}
+
 void Game::Game::startGameLoop(Side startingSide) {
     this->currentSide = startingSide;
+    if (this->moveLog) this->moveLog->beginGame(this->teams, startingSide, this->board);
 
-    while (!this->board->isGameFinished()) {
+    while (!this->board.isGameFinished()) {
         UI::MoveOrLoad moveOrLoad;
-        Team *currentTeam;
-
-        if (this->currentSide == Side::RedSide) currentTeam = this->teams->getRed();
-        else currentTeam = this->teams->getBlue();
-
-        if (currentTeam->getType() == TeamType::Player) {
-            std::vector<MoveWithBorderingStatus> legalMoves =
-                    this->board->findLegalMoves(this->currentSide, std::nullopt);
+        const Team &currentTeam = this->teams.getBySide(this->currentSide);
 
+        if (currentTeam.getType() == TeamType::Player) {
             // move should be skipped if there are no legal moves
-            if (!legalMoves.empty())
-                moveOrLoad = this->ui->getMove(*(this->board), this->currentSide, *(this->teams));
+            if (this->board.hasLegalMove(this->currentSide))
+                moveOrLoad = this->ui->getMove(this->board, this->currentSide, this->teams);
             else moveOrLoad = UI::MoveOrLoad(std::nullopt, std::nullopt);
-        } else if (currentTeam->getType() == TeamType::Computer)
-            moveOrLoad = UI::MoveOrLoad(this->board->findBestMove(this->currentSide), std::nullopt);
+        } else if (currentTeam.getType() == TeamType::Computer)
+            moveOrLoad = UI::MoveOrLoad(
+                    this->computerEngine->findMove(this->board, this->currentSide),
+                    std::nullopt);
+        else if (currentTeam.getType() == TeamType::MctsComputer)
+            moveOrLoad = UI::MoveOrLoad(
+                    this->mctsEngine->findMove(this->board, this->currentSide),
+                    std::nullopt);
 
         if (moveOrLoad.loadedGame.has_value()) {
+            if (this->moveLog) this->moveLog->abandonGame();
             this->startGame(moveOrLoad.loadedGame->teams, moveOrLoad.loadedGame->side, moveOrLoad.loadedGame->board);
             return;
         }
-        if (moveOrLoad.move.has_value()) this->board->makeMove(this->currentSide, moveOrLoad.move.value());
+        if (moveOrLoad.move.has_value()) this->board.makeMove(this->currentSide, moveOrLoad.move.value());
 
         // switching sides
         if (this->currentSide == Side::RedSide) this->currentSide = Side::BlueSide;
         else if (this->currentSide == Side::BlueSide) this->currentSide = Side::RedSide;
 
-        // it is possible that one of the teams loses all the pawns when there are still empty fields,
-        // there is no sense in continuing a game like that
-        Points points = board->getPoints();
-        if (points.getTeamPoints(RedSide) == 0) board->fillBoardWithState(Blue);
-        if (points.getTeamPoints(BlueSide) == 0) board->fillBoardWithState(Red);
+        this->board.fillBoardIfSideEliminated();
+
+        if (this->moveLog) this->moveLog->recordMove(this->board, moveOrLoad.move);
     }
 
-    this->ui->displayEndScreen(*(this->board), this->currentSide);
+    if (this->moveLog) this->moveLog->endGame();
+
+    this->ui->displayEndScreen(this->board, this->currentSide);
     updateRanking();
 }
 
 void Game::Game::updateRanking() {
-    Points points = this->board->getPoints();
+    Points points = this->board.getPoints();
 
     std::optional<std::string> rankingFile = FileManagement::FileManager::loadRankingFile();
     if (!rankingFile.has_value()) return;
@@ -2,17 +2,27 @@
 #define PJC_HEXAGON_GAME_H
 
 #include <iostream>
+#include <memory>
 #include "../UI/UI.h"
 #include "Board.h"
 #include "Move.h"
 #include "../FileManagement/FileManager.h"
+#include "../AI/Engine.h"
+#include "../FileManagement/MoveLog.h"
+#include "../FileManagement/OpeningBook.h"
 
 namespace Game {
     class Game {
     private:
-        UI::UI *ui;
-        Teams *teams;
-        Board *board;
+        std::unique_ptr<UI::UI> ui;
+        // makes the moves of the computer teams
+        std::unique_ptr<AI::Engine> computerEngine;
+        // makes the moves of the Monte Carlo computer teams
+        std::unique_ptr<AI::Engine> mctsEngine;
+        // if provided, every played game is written to it
+        std::unique_ptr<FileManagement::MoveLogWriter> moveLog;
+        Teams teams;
+        Board board;
         Side currentSide;
 
         void startGameLoop(Side startingSide);
@@ -23,7 +33,16 @@ namespace Game {
         /**
          * @param ui UI implementation to be used throughout the game
          */
-        explicit Game(UI::UI *ui);
+        explicit Game(std::unique_ptr<UI::UI> ui);
+
+        /**
+         * @param ui UI implementation to be used throughout the game
+         * @param computerEngine Engine used for picking the moves of the computer teams
+         * @param mctsEngine Engine used for picking the moves of the Monte Carlo computer teams
+         */
+        Game(std::unique_ptr<UI::UI> ui,
+             std::unique_ptr<AI::Engine> computerEngine,
+             std::unique_ptr<AI::Engine> mctsEngine);
 
         /**
          * Initialization of teams using the provided UI implementation. At this stage the can be loaded from
@@ -40,7 +59,17 @@ namespace Game {
         /**
          * Starts a game using existing data, can be used for starting a game loaded from a save.
          */
-        void startGame(Teams *_teams, Side startingSide, Board *_board);
+        void startGame(const Teams &_teams, Side startingSide, const Board &_board);
+
+        /**
+         * @param _moveLog Every game started after this call will be written to it, move by move
+         */
+        void setMoveLog(std::unique_ptr<FileManagement::MoveLogWriter> _moveLog);
+
+        /**
+         * @param book The computer teams play the moves saved in it, the other positions are still searched
+         */
+        void setOpeningBook(std::shared_ptr<const FileManagement::OpeningBook> book);
 
         /**
          * Should be called after the game is finished, updates the ranking file
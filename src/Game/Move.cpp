@@ -14,3 +14,8 @@ Game::MoveWithBorderingStatus::MoveWithBorderingStatus(Game::MoveUnit from, Game
         : Move(from, to) {
     this->isBordering = isBordering;
 }
+
+Game::CellMove::CellMove(short from, short to) {
+    this->from = from;
+    this->to = to;
+}
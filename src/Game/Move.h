@@ -1,9 +1,14 @@
 #ifndef PJC_HEXAGON_MOVE_H
 #define PJC_HEXAGON_MOVE_H
 
+#include <array>
 #include "Field.h"
 
 namespace Game {
+    // upper bound of the count of moves returned by \p Board::generateMoves in any position, as every empty field
+    // is reached by at most one clone move, and every pawn has at most 12 fields to jump to
+    const short MAX_MOVES_COUNT = BOARD_CELLS_COUNT * 13;
+
     // pointer to some space on the board, may not point to the actual field
     // needed for storing data like user input
     class MoveUnit {
@@ -36,6 +41,23 @@ namespace Game {
 
         MoveWithBorderingStatus(MoveUnit from, MoveUnit to, bool isBordering);
     };
+
+    /**
+     * Move between the fields given by their cell indexes, used by the engines which do not need
+     * the positions of the fields
+     */
+    class CellMove {
+    public:
+        short from;
+        short to;
+
+        CellMove() = default;
+
+        CellMove(short from, short to);
+    };
+
+    // fixed capacity buffer filled by the move generator, so generating moves never allocates
+    using MoveBuffer = std::array<CellMove, MAX_MOVES_COUNT>;
 }
 
 
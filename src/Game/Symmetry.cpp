@@ -0,0 +1,26 @@
+#include "Symmetry.h"
+
+using namespace Game;
+
+CanonicalKey::CanonicalKey(std::uint64_t key, Symmetry symmetry) : key(key), symmetry(symmetry) {}
+
+Bitboard Symmetries::transformCells(Bitboard cells, Symmetry symmetry) {
+    if (!(symmetry & Mirror)) return cells;
+
+    Bitboard transformedCells = 0;
+    while (cells != 0)
+        transformedCells |= Bitboards::cellMask(transformCell(Bitboards::popLowestCell(cells), symmetry));
+
+    return transformedCells;
+}
+
+CellMove Symmetries::transformMove(CellMove move, Symmetry symmetry) {
+    return {transformCell(move.from, symmetry), transformCell(move.to, symmetry)};
+}
+
+Move Symmetries::transformMove(Move move, Symmetry symmetry) {
+    if (!(symmetry & Mirror)) return move;
+
+    return {MoveUnit(move.from.row, BOARD_COLUMNS_COUNT - 1 - move.from.uiColumn),
+            MoveUnit(move.to.row, BOARD_COLUMNS_COUNT - 1 - move.to.uiColumn)};
+}
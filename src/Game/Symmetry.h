@@ -0,0 +1,100 @@
+#ifndef PJC_HEXAGON_SYMMETRY_H
+#define PJC_HEXAGON_SYMMETRY_H
+
+#include <array>
+#include <cstdint>
+#include "Bitboard.h"
+#include "Zobrist.h"
+
+namespace Game {
+    /**
+     * Transformations mapping a position to an equivalent one. The board and its blocked fields are symmetric
+     * to the vertical axis, so mirroring the fields' columns does not change the game, and neither does swapping
+     * the colours of all the pawns together with the side making a move. Bits can be combined.
+     */
+    enum Symmetry {
+        Identity = 0,
+        Mirror = 1,
+        ColourSwap = 2,
+        MirrorColourSwap = 3,
+    };
+
+    const short SYMMETRIES_COUNT = 4;
+
+    /**
+     * Key shared by all the equivalent positions, and the symmetry which maps the position to the canonical one.
+     * Every symmetry is its own inverse, so the same symmetry maps the canonical moves back to the position.
+     */
+    class CanonicalKey {
+    public:
+        std::uint64_t key;
+        Symmetry symmetry;
+
+        CanonicalKey() = default;
+
+        CanonicalKey(std::uint64_t key, Symmetry symmetry);
+    };
+
+    /**
+     * Lookup tables of the symmetries, generated at compile time.
+     */
+    class SymmetryTables {
+    public:
+        std::array<short, BOARD_CELLS_COUNT> mirroredCell{};
+        // Zobrist keys of the transformed fields, by the field, its state before the transformation and the symmetry
+        std::array<std::array<std::array<std::uint64_t, SYMMETRIES_COUNT>, 4>, BOARD_CELLS_COUNT> cellKeys{};
+
+        constexpr SymmetryTables() {
+            for (short i = 0; i < BOARD_CELLS_COUNT; i++) {
+                mirroredCell[i] = Bitboards::cellIndex(
+                        static_cast<short>(CELL_TABLES.row[i]),
+                        static_cast<short>(BOARD_COLUMNS_COUNT - 1 - CELL_TABLES.uiColumn[i]));
+            }
+
+            for (short i = 0; i < BOARD_CELLS_COUNT; i++) {
+                for (FieldState state: {Empty, Red, Blue, Blocked}) {
+                    for (short symmetry = 0; symmetry < SYMMETRIES_COUNT; symmetry++) {
+                        short cell = symmetry & Mirror ? mirroredCell[i] : i;
+                        FieldState transformedState = state;
+                        if (symmetry & ColourSwap && state == Red) transformedState = Blue;
+                        else if (symmetry & ColourSwap && state == Blue) transformedState = Red;
+
+                        cellKeys[i][state][symmetry] = Zobrist::cellKey(cell, transformedState);
+                    }
+                }
+            }
+        }
+    };
+
+    constexpr SymmetryTables SYMMETRY_TABLES;
+
+    class Symmetries {
+    public:
+        /**
+         * @return Index of the field to which the symmetry moves the field
+         */
+        static constexpr short transformCell(short cellIndex, Symmetry symmetry) {
+            return symmetry & Mirror ? SYMMETRY_TABLES.mirroredCell[cellIndex] : cellIndex;
+        }
+
+        static constexpr Side transformSide(Side side, Symmetry symmetry) {
+            return symmetry & ColourSwap ? (side == RedSide ? BlueSide : RedSide) : side;
+        }
+
+        /**
+         * @return Key of the \p state of the field after the symmetry is applied to the field, see
+         * \p Zobrist::cellKey
+         */
+        static constexpr std::uint64_t cellKey(short cellIndex, FieldState state, Symmetry symmetry) {
+            return SYMMETRY_TABLES.cellKeys[cellIndex][state][symmetry];
+        }
+
+        static Bitboard transformCells(Bitboard cells, Symmetry symmetry);
+
+        static CellMove transformMove(CellMove move, Symmetry symmetry);
+
+        static Move transformMove(Move move, Symmetry symmetry);
+    };
+}
+
+#endif //PJC_HEXAGON_SYMMETRY_H
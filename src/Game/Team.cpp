@@ -13,6 +13,10 @@ FieldState Team::sideToFieldStatus(Side side) {
     }
 }
 
+Side Team::oppositeSide(Side side) {
+    return side == RedSide ? BlueSide : RedSide;
+}
+
 Team::Team(Side side, TeamType type) {
     this->side = side;
     this->type = type;
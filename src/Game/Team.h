@@ -14,6 +14,8 @@ namespace Game {
     enum TeamType {
         Player = 0,
         Computer = 1,
+        // computer team picking the moves with Monte Carlo Tree Search
+        MctsComputer = 2,
     };
 
     class Team {
@@ -27,6 +29,11 @@ namespace Game {
 
         static Game::FieldState sideToFieldStatus(Side side);
 
+        /**
+         * @return Side playing against the provided \p side
+         */
+        static Side oppositeSide(Side side);
+
         Side getSide() const;
 
         TeamType getType() const;
@@ -6,16 +6,21 @@
 
 namespace Game {
     class Teams {
-        Team *red;
-        Team *blue;
+        Team red;
+        Team blue;
     public:
         Teams() = default;
 
-        Teams(Team *red, Team *blue);
+        Teams(Team red, Team blue);
 
-        Team *getRed() const;
+        const Team &getRed() const;
 
-        Team *getBlue() const;
+        const Team &getBlue() const;
+
+        /**
+         * @return Team playing on the provided \p side
+         */
+        const Team &getBySide(Side side) const;
     };
 }
 
@@ -0,0 +1,68 @@
+#ifndef PJC_HEXAGON_ZOBRIST_H
+#define PJC_HEXAGON_ZOBRIST_H
+
+#include <array>
+#include <cstdint>
+#include "../Consts.h"
+#include "Field.h"
+#include "Team.h"
+
+namespace Game {
+    /**
+     * Random keys used for hashing the boards, generated at compile time, so the hashes are the same in every run
+     * and can be saved in files.
+     */
+    class ZobristKeys {
+    private:
+        static constexpr std::uint64_t splitMix(std::uint64_t &seed) {
+            std::uint64_t value = (seed += 0x9E3779B97F4A7C15ULL);
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31);
+        }
+
+    public:
+        // keys for Red and Blue states of every field, Empty and Blocked fields are not hashed
+        std::array<std::array<std::uint64_t, 2>, BOARD_CELLS_COUNT> cells{};
+        std::uint64_t blueSide = 0;
+
+        constexpr ZobristKeys() {
+            std::uint64_t seed = 0x5EED0F4E7A607ULL;
+
+            for (auto &cellKeys: cells) {
+                cellKeys[0] = splitMix(seed);
+                cellKeys[1] = splitMix(seed);
+            }
+
+            blueSide = splitMix(seed);
+        }
+    };
+
+    constexpr ZobristKeys ZOBRIST_KEYS;
+
+    /**
+     * Hash of a board is a xor of the keys of all its pawns, so it can be updated incrementally
+     * whenever a state of a field changes.
+     */
+    class Zobrist {
+    public:
+        /**
+         * @return Key of the field in the provided \p state, 0 for the states which are not hashed
+         */
+        static constexpr std::uint64_t cellKey(short cellIndex, FieldState state) {
+            if (state == Red) return ZOBRIST_KEYS.cells[cellIndex][0];
+            if (state == Blue) return ZOBRIST_KEYS.cells[cellIndex][1];
+            return 0;
+        }
+
+        /**
+         * @return Key which should be mixed into the board's hash when the position is hashed together with
+         * the side making a move
+         */
+        static constexpr std::uint64_t sideKey(Side side) {
+            return side == BlueSide ? ZOBRIST_KEYS.blueSide : 0;
+        }
+    };
+}
+
+#endif //PJC_HEXAGON_ZOBRIST_H
@@ -0,0 +1,175 @@
+#include "BoardRenderer.h"
+
+using namespace UI;
+
+BoardRenderer::BoardRenderer(RenderMode mode) : mode(mode) {
+    // labels, every cell of the grid at its longest and the cursor escape codes of the diff mode
+    this->frame.reserve(
+            (HEADER_LINES + BOARD_ROWS_COUNT) * (LABEL_WIDTH + BOARD_COLUMNS_COUNT * MAX_CELL_BYTES + 1) + 64);
+}
+
+void BoardRenderer::render(
+        std::ostream &stream,
+        const Game::Board &board,
+        short selectedCell,
+        Game::Bitboard highlightedCells) {
+    this->frame.clear();
+
+    if (this->mode == RenderMode::Diff && this->isFrameDrawn)
+        composeChangedCells(board, selectedCell, highlightedCells);
+    else {
+        // in the diff mode the board is anchored to the top of the cleared screen, so it can be redrawn in place
+        if (this->mode == RenderMode::Diff) this->frame += "\033[H\033[2J";
+        composeFullFrame(board, selectedCell, highlightedCells);
+        this->isFrameDrawn = true;
+    }
+
+    stream.write(this->frame.data(), static_cast<std::streamsize>(this->frame.size()));
+    stream.flush();
+}
+
+void BoardRenderer::invalidate() {
+    this->isFrameDrawn = false;
+}
+
+RenderMode BoardRenderer::getMode() const {
+    return this->mode;
+}
+
+void BoardRenderer::composeFullFrame(
+        const Game::Board &board,
+        short selectedCell,
+        Game::Bitboard highlightedCells) {
+    // column labels
+    this->frame += "    ";
+    for (short i = 0; i < BOARD_COLUMNS_COUNT; i++) {
+        // 49 is an ascii for '1'
+        appendCell(static_cast<char>(i + 49), None, "");
+    }
+    this->frame += "\n\n";
+
+    for (short row = 0; row < BOARD_ROWS_COUNT; row++) {
+        this->frame += std::to_string(row + 1);
+        this->frame += row + 1 > 9 ? "  " : "   ";
+
+        for (short uiColumn = 0; uiColumn < BOARD_COLUMNS_COUNT; uiColumn++) {
+            short cell = Game::Bitboards::cellIndex(row, uiColumn);
+
+            // empty cells on the sides and between the fields
+            if (cell == Game::NO_CELL) {
+                appendCell(' ', None, "");
+                continue;
+            }
+
+            Game::FieldState state = board.getCellState(cell);
+            CellModifier modifier = getCellModifier(cell, selectedCell, highlightedCells);
+
+            appendCell(fieldStateToChar(state), modifier, fieldStateToColor(state));
+            this->drawnCells[row][uiColumn] = packCell(fieldStateToChar(state), modifier);
+        }
+
+        this->frame += '\n';
+    }
+}
+
+void BoardRenderer::composeChangedCells(
+        const Game::Board &board,
+        short selectedCell,
+        Game::Bitboard highlightedCells) {
+    for (short cell = 0; cell < BOARD_CELLS_COUNT; cell++) {
+        Game::FieldState state = board.getCellState(cell);
+        CellModifier modifier = getCellModifier(cell, selectedCell, highlightedCells);
+
+        short row = Game::Bitboards::cellRow(cell);
+        short uiColumn = Game::Bitboards::cellUiColumn(cell);
+        std::uint16_t packedCell = packCell(fieldStateToChar(state), modifier);
+        if (this->drawnCells[row][uiColumn] == packedCell) continue;
+
+        appendCursorPosition(
+                static_cast<short>(HEADER_LINES + row + 1),
+                static_cast<short>(LABEL_WIDTH + uiColumn * CELL_WIDTH + 1));
+        appendCell(fieldStateToChar(state), modifier, fieldStateToColor(state));
+        this->drawnCells[row][uiColumn] = packedCell;
+    }
+
+    // the output following the board starts below it, overwriting whatever was displayed there previously
+    appendCursorPosition(HEADER_LINES + BOARD_ROWS_COUNT + 1, 1);
+    this->frame += "\033[J";
+}
+
+void BoardRenderer::appendCell(char middleChar, CellModifier modifier, const char *charColor) {
+    switch (modifier) {
+        case None:
+            this->frame += "  ";
+            break;
+        case Selected:
+            this->frame += " [";
+            break;
+        case MovePossible:
+            this->frame += " (";
+            break;
+    }
+
+    this->frame += charColor;
+    this->frame += middleChar;
+    this->frame += "\033[0m";
+
+    switch (modifier) {
+        case None:
+            this->frame += "  ";
+            break;
+        case Selected:
+            this->frame += "] ";
+            break;
+        case MovePossible:
+            this->frame += ") ";
+            break;
+    }
+}
+
+CellModifier BoardRenderer::getCellModifier(short cell, short selectedCell, Game::Bitboard highlightedCells) {
+    if (cell == selectedCell) return Selected;
+    if (highlightedCells & Game::Bitboards::cellMask(cell)) return MovePossible;
+    return None;
+}
+
+std::uint16_t BoardRenderer::packCell(char middleChar, CellModifier modifier) {
+    // zero is left for the cells which were never drawn
+    return static_cast<std::uint16_t>(static_cast<unsigned char>(middleChar) | (modifier + 1) << 8);
+}
+
+void BoardRenderer::appendCursorPosition(short line, short column) {
+    this->frame += "\033[";
+    this->frame += std::to_string(line);
+    this->frame += ';';
+    this->frame += std::to_string(column);
+    this->frame += 'H';
+}
+
+char BoardRenderer::fieldStateToChar(Game::FieldState state) {
+    switch (state) {
+        case Game::FieldState::Blocked:
+            return 'X';
+        case Game::FieldState::Red:
+            return 'R';
+        case Game::FieldState::Blue:
+            return 'B';
+        case Game::FieldState::Empty:
+        default:
+            return '0';
+    }
+}
+
+const char *BoardRenderer::fieldStateToColor(Game::FieldState state) {
+    switch (state) {
+        case Game::FieldState::Blocked:
+            return "";
+        case Game::FieldState::Red:
+            return "\033[31m";
+        case Game::FieldState::Blue:
+            return "\033[34m";
+        case Game::FieldState::Empty:
+        default:
+            return "";
+    }
+}
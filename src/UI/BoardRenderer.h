@@ -0,0 +1,99 @@
+#ifndef PJC_HEXAGON_BOARDRENDERER_H
+#define PJC_HEXAGON_BOARDRENDERER_H
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include "../Game/Board.h"
+
+namespace UI {
+    enum CellModifier {
+        None = 0,
+        Selected = 1,
+        MovePossible = 2,
+    };
+
+    enum class RenderMode {
+        // every frame is written in full below the previous output
+        Full,
+        // after the first frame only the changed cells are redrawn in place using the cursor escape codes
+        Diff,
+    };
+
+    /**
+     * Composes the board frames for the terminal. Whole frame is built in a single preallocated buffer and written
+     * to the stream at once, so displaying the board does not allocate or flush per cell.
+     */
+    class BoardRenderer {
+    private:
+        // number of characters taken by the row labels in front of every line
+        static const short LABEL_WIDTH = 4;
+        // number of visible characters taken by a single cell
+        static const short CELL_WIDTH = 5;
+        // number of lines above the first board row (column labels and an empty line)
+        static const short HEADER_LINES = 2;
+        // upper bound of bytes in a cell with a modifier and color codes
+        static const short MAX_CELL_BYTES = 16;
+
+        RenderMode mode;
+        std::string frame;
+
+        // content of every cell drawn in the previous frame, only used in the diff mode
+        std::array<std::array<std::uint16_t, BOARD_COLUMNS_COUNT>, BOARD_ROWS_COUNT> drawnCells{};
+        bool isFrameDrawn = false;
+
+        void appendCell(char middleChar, CellModifier modifier, const char *charColor);
+
+        static CellModifier getCellModifier(short cell, short selectedCell, Game::Bitboard highlightedCells);
+
+        /**
+         * @return Character and modifier of the cell packed together, used for finding the cells changed since
+         * the previous frame
+         */
+        static std::uint16_t packCell(char middleChar, CellModifier modifier);
+
+        /**
+         * Appends the escape code which moves the cursor to the given 1-based screen position.
+         */
+        void appendCursorPosition(short line, short column);
+
+        void composeFullFrame(
+                const Game::Board &board,
+                short selectedCell,
+                Game::Bitboard highlightedCells);
+
+        void composeChangedCells(
+                const Game::Board &board,
+                short selectedCell,
+                Game::Bitboard highlightedCells);
+
+    public:
+        explicit BoardRenderer(RenderMode mode = RenderMode::Full);
+
+        /**
+         * Writes the board with labels to the \p stream.
+         * @param selectedCell Index of the cell displayed with \p Selected modifier, or \p Game::NO_CELL
+         * @param highlightedCells Cells displayed with \p MovePossible modifier
+         */
+        void render(
+                std::ostream &stream,
+                const Game::Board &board,
+                short selectedCell,
+                Game::Bitboard highlightedCells);
+
+        /**
+         * Forces the next frame to be drawn in full, e.g. after the screen was cleared by some other output.
+         */
+        void invalidate();
+
+        RenderMode getMode() const;
+
+        static char fieldStateToChar(Game::FieldState state);
+
+        static const char *fieldStateToColor(Game::FieldState state);
+    };
+}
+
+#endif //PJC_HEXAGON_BOARDRENDERER_H
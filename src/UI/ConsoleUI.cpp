@@ -2,21 +2,28 @@
 
 using namespace UI;
 
-std::optional<Game::Teams *> ConsoleUI::getTeams() {
+ConsoleUI::ConsoleUI(std::shared_ptr<FileManagement::PositionDatabase> database, RenderMode renderMode)
+        : database(std::move(database)), renderer(renderMode) {}
+
+std::optional<Game::Teams> ConsoleUI::getTeams() {
     std::string input = ConsoleUI::askForInput(
             "Choose game mode:\n"
             "[1] Player vs Player\n"
             "[2] Player vs Computer\n"
-            "[3] Load the game",
-            {"1", "2", "3"});
+            "[3] Player vs Computer (Monte Carlo)\n"
+            "[4] Load the game",
+            {"1", "2", "3", "4"});
 
-    if (input == "3") return std::nullopt;
+    if (input == "4") return std::nullopt;
 
     if (input == "1")
-        return new Game::Teams(new Game::Team(Game::Side::RedSide, Game::TeamType::Player),
-                               new Game::Team(Game::Side::BlueSide, Game::TeamType::Player));
-    return new Game::Teams(new Game::Team(Game::Side::RedSide, Game::TeamType::Player),
-                           new Game::Team(Game::Side::BlueSide, Game::TeamType::Computer));
+        return Game::Teams(Game::Team(Game::Side::RedSide, Game::TeamType::Player),
+                           Game::Team(Game::Side::BlueSide, Game::TeamType::Player));
+    if (input == "3")
+        return Game::Teams(Game::Team(Game::Side::RedSide, Game::TeamType::Player),
+                           Game::Team(Game::Side::BlueSide, Game::TeamType::MctsComputer));
+    return Game::Teams(Game::Team(Game::Side::RedSide, Game::TeamType::Player),
+                       Game::Team(Game::Side::BlueSide, Game::TeamType::Computer));
 }
 
 MoveOrLoad ConsoleUI::getMove(
@@ -26,9 +33,11 @@ MoveOrLoad ConsoleUI::getMove(
     std::optional<Game::Move> move;
 
     do {
-        if (move.has_value()) std::cout << "Move is illegal" << std::endl;
-
+        // the prompts of the illegal move could have scrolled the board in the diff mode
+        if (move.has_value()) this->renderer.invalidate();
         displayBoard(board, side, std::nullopt);
+        // displayed below the board, as in the diff mode everything displayed below it gets redrawn
+        if (move.has_value()) std::cout << "Move is illegal" << std::endl;
         displayPoints(board.getPoints());
         displayMoveTeam(side);
 
@@ -37,13 +46,16 @@ MoveOrLoad ConsoleUI::getMove(
 
         // selecting a pawn to be moved, looped until the user selects correct field with a pawn that can be moved
         std::optional<Game::MoveUnit> from;
-        std::optional<Game::Field *> fromField;
+        std::optional<const Game::Field *> fromField;
         bool shouldMoveBeContinued = false;
         bool hasLegalMoves;
 
         do {
             // errors should be displayed only when user has provided some input
             if (from.has_value()) {
+                // the board is not redrawn until a pawn is picked, so the errors could scroll it in the diff mode
+                this->renderer.invalidate();
+
                 if (fromField.has_value() && fromField.value()->getState() != Game::FieldState::Empty &&
                     fromField.value()->getState() != Game::FieldState::Blocked)
                     std::cout << "No moves can be made with picked pawn" << std::endl;
@@ -139,6 +151,8 @@ Game::MoveUnit ConsoleUI::getMoveUnit() {
 }
 
 void ConsoleUI::displayEndScreen(const Game::Board &board, const Game::Side &side) const {
+    // final board is displayed in full, so it stays on the screen together with the result
+    this->renderer.invalidate();
     displayBoard(board, side, std::nullopt);
 
     Game::Points points = board.getPoints();
@@ -177,87 +191,23 @@ std::string ConsoleUI::askForInput(const std::string &question, const std::funct
     return answer;
 }
 
-void
-ConsoleUI::displayBoard(const Game::Board &board, const Game::Side &side, std::optional<Game::Field *> selectedField) {
-    // displays column labels
-    std::cout << "    ";
-    for (short i = 0; i < BOARD_COLUMNS_COUNT; i++) {
-        // 49 is an ascii for '1'
-        displayBoardCell(i + 49, None, "");
-    }
-    std::cout << std::endl << std::endl;
+void ConsoleUI::displayBoard(
+        const Game::Board &board,
+        const Game::Side &side,
+        std::optional<const Game::Field *> selectedField) const {
+    short selectedCell = Game::NO_CELL;
+    // all the fields to which a move can be made from the selected field (if provided)
+    Game::Bitboard highlightedCells = 0;
 
-    // finds all the fields to which a move can be made from the selected field (if provided)
-    std::vector<Game::Field *> fieldsToHighlight;
     if (selectedField.has_value()) {
-        std::vector<Game::MoveWithBorderingStatus> moves = board.findLegalMoves(side, selectedField);
-        std::for_each(moves.begin(), moves.end(), [&board, &fieldsToHighlight](Game::MoveWithBorderingStatus move) {
-            std::optional<Game::Field *> field = board.getFieldByMoveUnit(move.to);
-
-            if (field.has_value()) fieldsToHighlight.emplace_back(field.value());
-        });
-    }
+        const Game::Field *field = selectedField.value();
+        selectedCell = Game::Bitboards::cellIndex(field->getRow(), field->getUiColumn());
 
-    for (short i = 0; i < BOARD_ROWS_COUNT; i++) {
-        displayBoardRow(board.getFields()[i], i, selectedField, fieldsToHighlight);
+        for (const Game::MoveWithBorderingStatus &move: board.findLegalMoves(side, selectedField))
+            highlightedCells |= Game::Bitboards::cellMask(Game::Bitboards::cellIndex(move.to));
     }
-}
-
-void ConsoleUI::displayBoardRow(
-        const std::vector<Game::Field *> &row,
-        short rowIndex,
-        std::optional<Game::Field *> selectedField,
-        std::vector<Game::Field *> fieldsToHighlight) {
-    std::string rowNumberLabel = rowIndex + 1 > 9 ? "  " : "   ";
-    std::cout << rowIndex + 1 << rowNumberLabel;
-
-    short sideEmptyColumns = (BOARD_COLUMNS_COUNT - (row.size() * 2 - 1)) / 2;
-
-    for (short uiColumn = 0; uiColumn < BOARD_COLUMNS_COUNT; uiColumn++) {
-        // display empty cells on the sides
-        if (uiColumn < sideEmptyColumns || uiColumn >= BOARD_COLUMNS_COUNT - sideEmptyColumns) {
-            displayBoardCell(' ', None, "");
-            continue;
-        }
-
-        // display empty cells between the fields
-        if (uiColumn % 2 == row.size() % 2) displayBoardCell(' ', None, "");
-            // display fields
-        else {
-            // calculates a cell modifier based on provided fields
-            CellModifier modifier = None;
-            if (selectedField.has_value() && selectedField.value()->getRow() == rowIndex &&
-                selectedField.value()->getUiColumn() == uiColumn)
-                modifier = Selected;
-            else {
-                auto it = std::find_if(fieldsToHighlight.begin(), fieldsToHighlight.end(),
-                                       [rowIndex, uiColumn](Game::Field *field) {
-                                           return field->getRow() == rowIndex && field->getUiColumn() == uiColumn;
-                                       });
-
-                if (it != fieldsToHighlight.end()) modifier = MovePossible;
-            }
-
-            Game::FieldState fieldState = row[(uiColumn - sideEmptyColumns) / 2]->getState();
-            displayBoardCell(fieldStateToChar(fieldState), modifier, fieldStateToColor(fieldState));
-        }
-    }
-
-    std::cout << std::endl;
-}
 
-void ConsoleUI::displayBoardCell(char middleChar, CellModifier modifier, const std::string &charColor) {
-    switch (modifier) {
-        case None:
-            std::cout << "  " << charColor << middleChar << "\033[0m" << "  ";
-            return;
-        case Selected:
-            std::cout << " [" << charColor << middleChar << "\033[0m" << "] ";
-            return;
-        case MovePossible:
-            std::cout << " (" << charColor << middleChar << "\033[0m" << ") ";
-            return;
-    }
+    this->renderer.render(std::cout, board, selectedCell, highlightedCells);
 }
 
 void ConsoleUI::displayMoveTeam(Game::Side side) {
@@ -275,36 +225,34 @@ void ConsoleUI::displayPoints(Game::Points points) {
               << " - Blue: " << points.getTeamPoints(Game::Side::BlueSide) << std::endl;
 }
 
-char ConsoleUI::fieldStateToChar(Game::FieldState state) {
-    switch (state) {
-        case Game::FieldState::Blocked:
-            return 'X';
-        case Game::FieldState::Red:
-            return 'R';
-        case Game::FieldState::Blue:
-            return 'B';
-        case Game::FieldState::Empty:
-        default:
-            return '0';
-    }
-}
+std::optional<FileManagement::DeserializedGame> ConsoleUI::loadGame() const {
+    // prompts are displayed below the board, and the loaded game's board has nothing in common with the drawn one
+    this->renderer.invalidate();
 
-std::string ConsoleUI::fieldStateToColor(Game::FieldState state) {
-    switch (state) {
-        case Game::FieldState::Blocked:
-            return "";
-        case Game::FieldState::Red:
-            return "\033[31m";
-        case Game::FieldState::Blue:
-            return "\033[34m";
-        case Game::FieldState::Empty:
-        default:
-            return "";
+    std::string filename = askForInput("Enter the save name:", [](const std::string &answer) { return true; });
+
+    if (this->database) {
+        std::optional<FileManagement::DeserializedGame> game = this->database->findByName(filename);
+        if (!game.has_value()) std::cout << "Game is not saved in the database" << std::endl;
+
+        return game;
     }
-}
 
-std::optional<FileManagement::DeserializedGame> ConsoleUI::loadGame() const {
-    std::string filename = askForInput("Enter the save name:", [](const std::string &answer) { return true; });
+    // binary saves are preferred, the first game of an archive is loaded
+    std::optional<FileManagement::MappedFile> binarySaveFile =
+            FileManagement::FileManager::loadBinarySaveFile(filename);
+    if (binarySaveFile.has_value()) {
+        std::optional<FileManagement::DeserializedGame> game =
+                FileManagement::BinaryGameSerializer::deserializeGame(
+                        binarySaveFile->getData(),
+                        binarySaveFile->getSize());
+        if (!game.has_value()) {
+            std::cout << "File is corrupted" << std::endl;
+            return std::nullopt;
+        }
+
+        return game.value();
+    }
 
     std::optional<std::string> saveFile = FileManagement::FileManager::loadSaveFile(filename);
     if (!saveFile.has_value()) {
@@ -323,11 +271,16 @@ std::optional<FileManagement::DeserializedGame> ConsoleUI::loadGame() const {
 }
 
 void ConsoleUI::saveGame(const Game::Teams &teams, const Game::Side &side, const Game::Board &board) const {
+    // prompts are displayed below the board, which is not redrawn before the next action is asked for
+    this->renderer.invalidate();
+
     std::string game = FileManagement::GameSerializer::serializeGame(teams, side, board);
 
     std::string filename = askForInput("Enter the save name:", [](const std::string &answer) { return true; });
 
-    bool saveSuccessful = FileManagement::FileManager::createSaveFile(filename, game);
+    bool saveSuccessful = this->database
+                          ? this->database->save(filename, teams, side, board)
+                          : FileManagement::FileManager::createSaveFile(filename, game);
 
     if (saveSuccessful) std::cout << "Game successfully saved" << std::endl;
     else std::cout << "Failed to save the game" << std::endl;
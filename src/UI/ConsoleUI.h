@@ -4,51 +4,32 @@
 #include <algorithm>
 #include <iostream>
 #include "UI.h"
+#include "BoardRenderer.h"
 #include "../Game/Field.h"
 #include "../Game/Teams.h"
 #include "../Game/Move.h"
+#include "../FileManagement/BinaryGameSerializer.h"
 #include "../FileManagement/FileManager.h"
 
 namespace UI {
-    enum CellModifier {
-        None = 0,
-        Selected = 1,
-        MovePossible = 2,
-    };
-
     class ConsoleUI : public UI {
     private:
+        // if provided, games are saved to and loaded from the database instead of the separate save files
+        std::shared_ptr<FileManagement::PositionDatabase> database;
+        // keeps the previously drawn frame, so it is modified even when displaying from the const methods
+        mutable BoardRenderer renderer;
+
         /**
-         * Displays whole board with labels by displaying every row in it with \p displayBoardRow.
+         * Displays whole board with labels using the \p renderer.
          * @param board Board to be displayed
          * @param side Side currently making a move
          * @param selectedField If provided, the field will be highlighted, as well as all the field
          * to which a move can be made from that field
          */
-        static void displayBoard(
+        void displayBoard(
                 const Game::Board &board,
                 const Game::Side &side,
-                std::optional<Game::Field *> selectedField);
-
-        /**
-         * Displays board's row by displaying every cell in it with \p displayBoardCell.
-         * @param row Row of fields to be displayed
-         * @param rowIndex Index of a row being displayed
-         * @param selectedField If found in the row, the cell will be displayed with \p Selected modifier
-         * @param fieldsToHighlight If found in the row, the cell will be displayed with \p MovePossible modifier
-         */
-        static void displayBoardRow(
-                const std::vector<Game::Field *> &row,
-                short rowIndex,
-                std::optional<Game::Field *> selectedField,
-                std::vector<Game::Field *> fieldsToHighlight);
-
-        /**
-         * @param middleChar Indicates a status of the field
-         * @param modifier Displayed for cells which represent selected field or one to which move can be made
-         * @param charColor ANSI code for changing the color of the passed char, can be an empty string to skip the color change
-         */
-        static void displayBoardCell(char middleChar, CellModifier modifier, const std::string &charColor);
+                std::optional<const Game::Field *> selectedField) const;
 
         /**
          * Displays name of the team currently making a move.
@@ -61,10 +42,6 @@ namespace UI {
          */
         static void displayPoints(Game::Points points);
 
-        static char fieldStateToChar(Game::FieldState state);
-
-        static std::string fieldStateToColor(Game::FieldState state);
-
         /**
          * Asked before user makes a move, can allows actions like saving and loading a game.
          * @return If the game is loaded correctly, its data will be returned
@@ -83,11 +60,19 @@ namespace UI {
     public:
         ConsoleUI() = default;
 
+        /**
+         * @param database Used for saving and loading the games instead of the separate save files
+         * @param renderMode \p Diff redraws only the changed cells of the board in place
+         */
+        explicit ConsoleUI(
+                std::shared_ptr<FileManagement::PositionDatabase> database,
+                RenderMode renderMode = RenderMode::Full);
+
         std::optional<FileManagement::DeserializedGame> loadGame() const override;
 
         void saveGame(const Game::Teams &teams, const Game::Side &side, const Game::Board &board) const override;
 
-        std::optional<Game::Teams *> getTeams() override;
+        std::optional<Game::Teams> getTeams() override;
 
         MoveOrLoad getMove(const Game::Board &board, const Game::Side &side, const Game::Teams &teams) const override;
 
@@ -0,0 +1,164 @@
+#include "EngineProtocol.h"
+
+using namespace UI;
+
+EngineProtocol::EngineProtocol(std::istream &input, std::ostream &output, std::size_t transpositionTableSize)
+        : input(input), output(output) {
+    this->transpositionTable = std::make_shared<AI::TranspositionTable>(transpositionTableSize);
+}
+
+EngineProtocol::~EngineProtocol() {
+    stopSearch();
+}
+
+void EngineProtocol::run() {
+    std::string line;
+
+    // reading the input never waits for the search, which runs on its own thread
+    while (std::getline(this->input, line)) {
+        std::istringstream arguments(line);
+        std::string command;
+        if (!(arguments >> command)) continue;
+
+        if (command == "uci") {
+            send("id name pjc_hexagon");
+            send("uciok");
+        } else if (command == "isready") send("readyok");
+        else if (command == "newgame") {
+            stopSearch();
+            this->transpositionTable->clear();
+        } else if (command == "position") handlePosition(arguments);
+        else if (command == "go") handleGo(arguments);
+        else if (command == "stop") stopSearch();
+        else if (command == "quit") break;
+        else send("info string unknown command " + command);
+    }
+
+    stopSearch();
+}
+
+void EngineProtocol::handlePosition(std::istringstream &arguments) {
+    stopSearch();
+
+    Game::Board newBoard;
+    Game::Side newSide = Game::Side::RedSide;
+    std::string token;
+    arguments >> token;
+
+    if (token == "cells") {
+        std::string red, blue, sideName;
+        if (!(arguments >> red >> blue >> sideName) || (sideName != "red" && sideName != "blue")) {
+            send("info string invalid position");
+            return;
+        }
+
+        try {
+            newBoard = Game::Board::fromBitboards(std::stoull(red, nullptr, 16), std::stoull(blue, nullptr, 16));
+        } catch (const std::exception &) {
+            send("info string invalid position");
+            return;
+        }
+        newSide = sideName == "red" ? Game::Side::RedSide : Game::Side::BlueSide;
+    } else if (token != "startpos") {
+        send("info string invalid position");
+        return;
+    }
+
+    if (arguments >> token && token == "moves") {
+        while (arguments >> token) {
+            if (token == "pass") {
+                // a side can pass only when it has no moves, just like in the game
+                if (newBoard.hasLegalMove(newSide)) {
+                    send("info string illegal move " + token);
+                    return;
+                }
+            } else {
+                std::optional<Game::Move> move = parseMove(token);
+                if (!move.has_value() || !newBoard.isMoveLegal(newSide, move.value())) {
+                    send("info string illegal move " + token);
+                    return;
+                }
+                newBoard.makeMove(newSide, move.value());
+            }
+
+            newSide = Game::Team::oppositeSide(newSide);
+            newBoard.fillBoardIfSideEliminated();
+        }
+    }
+
+    this->board = newBoard;
+    this->side = newSide;
+}
+
+void EngineProtocol::handleGo(std::istringstream &arguments) {
+    stopSearch();
+
+    AI::SearchLimits limits(MAX_SEARCH_DEPTH, std::chrono::milliseconds(0), 0);
+    std::string name;
+
+    try {
+        std::string value;
+        while (arguments >> name >> value) {
+            if (name == "depth") limits.depth = static_cast<short>(std::clamp(std::stoi(value), 1, 127));
+            else if (name == "movetime") limits.time = std::chrono::milliseconds(std::stoll(value));
+            else if (name == "nodes") limits.nodes = std::stoull(value);
+        }
+    } catch (const std::exception &) {
+        send("info string invalid limit " + name);
+        return;
+    }
+
+    this->stopSignal = false;
+    this->searchThread = std::thread(&EngineProtocol::search, this, this->board, this->side, limits);
+}
+
+void EngineProtocol::search(Game::Board searchedBoard, Game::Side searchedSide, AI::SearchLimits limits) {
+    AI::SearchEngine engine(limits, nullptr, this->transpositionTable);
+    engine.setStopSignal(&this->stopSignal);
+    engine.setIterationCallback([this, &engine, &searchedBoard, searchedSide](const AI::SearchStatistics &statistics) {
+        std::string line = "info depth " + std::to_string(statistics.depth) +
+                           " score " + std::to_string(statistics.score) +
+                           " nodes " + std::to_string(statistics.nodes) +
+                           " nps " + std::to_string(statistics.nodes * 1000 /
+                                                    std::max<long long>(statistics.time.count(), 1)) +
+                           " time " + std::to_string(statistics.time.count()) + " pv";
+
+        for (const Game::Move &move: engine.findPrincipalVariation(searchedBoard, searchedSide, statistics.depth))
+            line += " " + formatMove(move);
+
+        send(line);
+    });
+
+    std::optional<Game::Move> move = engine.findMove(searchedBoard, searchedSide);
+    send("bestmove " + (move.has_value() ? formatMove(move.value()) : std::string("pass")));
+}
+
+void EngineProtocol::stopSearch() {
+    if (!this->searchThread.joinable()) return;
+
+    this->stopSignal = true;
+    this->searchThread.join();
+}
+
+void EngineProtocol::send(const std::string &line) {
+    std::lock_guard<std::mutex> lock(this->outputMutex);
+    this->output << line << '\n';
+    this->output.flush();
+}
+
+std::optional<Game::Move> EngineProtocol::parseMove(const std::string &text) {
+    unsigned short fromRow, fromUiColumn, toRow, toUiColumn;
+    char comma1, dash, comma2;
+    std::istringstream moveStream(text);
+
+    if (!(moveStream >> fromRow >> comma1 >> fromUiColumn >> dash >> toRow >> comma2 >> toUiColumn) ||
+        comma1 != ',' || dash != '-' || comma2 != ',')
+        return std::nullopt;
+
+    return Game::Move(Game::MoveUnit(fromRow, fromUiColumn), Game::MoveUnit(toRow, toUiColumn));
+}
+
+std::string EngineProtocol::formatMove(const Game::Move &move) {
+    return std::to_string(move.from.row) + "," + std::to_string(move.from.uiColumn) + "-" +
+           std::to_string(move.to.row) + "," + std::to_string(move.to.uiColumn);
+}
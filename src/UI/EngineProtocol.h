@@ -0,0 +1,82 @@
+#ifndef PJC_HEXAGON_ENGINEPROTOCOL_H
+#define PJC_HEXAGON_ENGINEPROTOCOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include "../AI/SearchEngine.h"
+#include "../Game/Board.h"
+
+namespace UI {
+    /**
+     * Line based text protocol, similar to UCI, which lets other programs use the search without any menus.
+     * Commands read from the input:
+     * - uci - answered with the engine's name and \p uciok
+     * - isready - answered with \p readyok, also while searching
+     * - newgame - clears the transposition table
+     * - position startpos|cells RED_HEX BLUE_HEX red|blue [moves MOVE...] - sets the searched position, moves are
+     * written as fromRow,fromUiColumn-toRow,toUiColumn and \p pass is used by a side which cannot move
+     * - go [depth N] [movetime MILLISECONDS] [nodes N] - starts searching in the background, every finished
+     * iteration is reported with an \p info line, and the search ends with a \p bestmove line
+     * - stop - ends the current search as soon as possible
+     * - quit
+     */
+    class EngineProtocol {
+    private:
+        // depth used by go without any limits, so it runs until stopped
+        static const short MAX_SEARCH_DEPTH = 64;
+
+        std::istream &input;
+        std::ostream &output;
+        // info and bestmove lines are written by the searching thread
+        std::mutex outputMutex;
+
+        Game::Board board;
+        Game::Side side = Game::Side::RedSide;
+
+        std::shared_ptr<AI::TranspositionTable> transpositionTable;
+        std::thread searchThread;
+        std::atomic<bool> stopSignal{false};
+
+        void handlePosition(std::istringstream &arguments);
+
+        void handleGo(std::istringstream &arguments);
+
+        /**
+         * Searches a copy of the current position, runs on the \p searchThread.
+         */
+        void search(Game::Board searchedBoard, Game::Side searchedSide, AI::SearchLimits limits);
+
+        /**
+         * Aborts the running search and waits until it writes its best move.
+         */
+        void stopSearch();
+
+        void send(const std::string &line);
+
+    public:
+        /**
+         * @param transpositionTableSize Size of the table shared by all the searches, in megabytes
+         */
+        EngineProtocol(std::istream &input, std::ostream &output, std::size_t transpositionTableSize = 64);
+
+        ~EngineProtocol();
+
+        /**
+         * Handles the commands until the \p quit command or the end of the input.
+         */
+        void run();
+
+        /**
+         * @return Move parsed from the protocol notation, null option if the text is malformed
+         */
+        static std::optional<Game::Move> parseMove(const std::string &text);
+
+        static std::string formatMove(const Game::Move &move);
+    };
+}
+
+#endif //PJC_HEXAGON_ENGINEPROTOCOL_H
@@ -25,11 +25,13 @@ namespace UI {
      */
     class UI {
     public:
+        virtual ~UI() = default;
+
         /**
          * Displays initial screen.
          * @return Teams picked by the user, null option means that a game save should be loaded
          */
-        virtual std::optional<Game::Teams *> getTeams() = 0;
+        virtual std::optional<Game::Teams> getTeams() = 0;
 
         /**
          * Asks user for game save filename and loads the save, displays errors if there are any
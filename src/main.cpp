@@ -1,13 +1,84 @@
+#include <fstream>
 #include <iostream>
 #include "UI/ConsoleUI.h"
+#include "UI/EngineProtocol.h"
 #include "Game/Game.h"
 
-int main() {
-    auto *game = new Game::Game(new UI::ConsoleUI());
-    std::optional<FileManagement::DeserializedGame> deserializedGame = game->initializeTeams();
+namespace {
+    const std::string USAGE =
+            "Usage: pjc_hexagon [--database NAME] [--record FILE] [--render full|diff] [--book FILE]\n"
+            "       pjc_hexagon --protocol";
+}
+
+/**
+ * Usage: pjc_hexagon [--database NAME] [--record FILE] [--render full|diff] [--book FILE]
+ *        pjc_hexagon --protocol
+ * --database - games are saved to and loaded from a single database file instead of the separate save files
+ * --record - every played game is appended to the move log file
+ * --book - computer teams play the moves of the opening book built with hexagon_book before they start searching
+ * --render - diff redraws only the changed cells of the board in place instead of printing every board below
+ * --protocol - instead of the menus, the engine is driven with the text protocol described in \p EngineProtocol
+ */
+int main(int argc, char *argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--protocol") {
+        UI::EngineProtocol(std::cin, std::cout).run();
+        return 0;
+    }
+
+    std::shared_ptr<FileManagement::PositionDatabase> database;
+    std::ofstream moveLogFile;
+    UI::RenderMode renderMode = UI::RenderMode::Full;
+    std::shared_ptr<const FileManagement::OpeningBook> book;
+
+    for (int i = 1; i < argc; i += 2) {
+        std::string option = argv[i];
+
+        // every option takes a value
+        if (i + 1 == argc) {
+            std::cout << USAGE << std::endl;
+            return 2;
+        }
+
+        if (option == "--database") {
+            database = FileManagement::FileManager::openDatabase(argv[i + 1]);
+            if (!database) {
+                std::cout << "Failed to open the database" << std::endl;
+                return 1;
+            }
+        } else if (option == "--record") {
+            moveLogFile.open(argv[i + 1], std::ios::binary | std::ios::app);
+            if (!moveLogFile.is_open()) {
+                std::cout << "Failed to open the move log" << std::endl;
+                return 1;
+            }
+        } else if (option == "--book") {
+            std::optional<FileManagement::OpeningBook> openedBook = FileManagement::OpeningBook::open(argv[i + 1]);
+            if (!openedBook.has_value()) {
+                std::cout << "Failed to open the opening book" << std::endl;
+                return 1;
+            }
+            book = std::make_shared<const FileManagement::OpeningBook>(std::move(openedBook.value()));
+        } else if (option == "--render") {
+            std::string mode = argv[i + 1];
+            if (mode != "full" && mode != "diff") {
+                std::cout << USAGE << std::endl;
+                return 2;
+            }
+            renderMode = mode == "diff" ? UI::RenderMode::Diff : UI::RenderMode::Full;
+        } else {
+            std::cout << USAGE << std::endl;
+            return 2;
+        }
+    }
+
+    Game::Game game(std::make_unique<UI::ConsoleUI>(database, renderMode));
+    if (book) game.setOpeningBook(book);
+    if (moveLogFile.is_open()) game.setMoveLog(std::make_unique<FileManagement::MoveLogWriter>(moveLogFile));
+
+    std::optional<FileManagement::DeserializedGame> deserializedGame = game.initializeTeams();
     if (deserializedGame.has_value())
-        game->startGame(deserializedGame->teams, deserializedGame->side, deserializedGame->board);
-    else game->startGame();
+        game.startGame(deserializedGame->teams, deserializedGame->side, deserializedGame->board);
+    else game.startGame();
 
     return 0;
 }